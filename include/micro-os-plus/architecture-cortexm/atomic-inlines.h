@@ -0,0 +1,362 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <type_traits>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the Cortex-M atomic operations.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) bool
+  cortexm_architecture_atomic_compare_exchange (volatile uint32_t* object,
+                                                uint32_t* expected,
+                                                uint32_t desired)
+  {
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        uint32_t current = cortexm_architecture_ldrex (object);
+        if (current != *expected)
+          {
+            cortexm_architecture_clrex ();
+            *expected = current;
+            return false;
+          }
+      }
+    while (cortexm_architecture_strex (desired, object) != 0);
+    return true;
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    uint32_t current = *object;
+    bool result = (current == *expected);
+    if (result)
+      {
+        *object = desired;
+      }
+    else
+      {
+        *expected = current;
+      }
+    cortexm_architecture_interrupts_set_primask (primask);
+    return result;
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_exchange (volatile uint32_t* object,
+                                        uint32_t value)
+  {
+    uint32_t previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        previous = cortexm_architecture_ldrex (object);
+      }
+    while (cortexm_architecture_strex (value, object) != 0);
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    previous = *object;
+    *object = value;
+    cortexm_architecture_interrupts_set_primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    uint32_t previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        previous = cortexm_architecture_ldrex (object);
+      }
+    while (cortexm_architecture_strex (previous + value, object) != 0);
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    previous = *object;
+    *object = previous + value;
+    cortexm_architecture_interrupts_set_primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    uint32_t previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        previous = cortexm_architecture_ldrex (object);
+      }
+    while (cortexm_architecture_strex (previous - value, object) != 0);
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    previous = *object;
+    *object = previous - value;
+    cortexm_architecture_interrupts_set_primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                        uint32_t value)
+  {
+    uint32_t previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        previous = cortexm_architecture_ldrex (object);
+      }
+    while (cortexm_architecture_strex (previous | value, object) != 0);
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    previous = *object;
+    *object = previous | value;
+    cortexm_architecture_interrupts_set_primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    uint32_t previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    do
+      {
+        previous = cortexm_architecture_ldrex (object);
+      }
+    while (cortexm_architecture_strex (previous & value, object) != 0);
+#else
+    uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+    previous = *object;
+    *object = previous & value;
+    cortexm_architecture_interrupts_set_primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) bool
+  micro_os_plus_architecture_atomic_compare_exchange (
+      volatile uint32_t* object, uint32_t* expected, uint32_t desired)
+  {
+    return cortexm_architecture_atomic_compare_exchange (object, expected,
+                                                         desired);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_exchange (volatile uint32_t* object,
+                                              uint32_t value)
+  {
+    return cortexm_architecture_atomic_exchange (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_add (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_sub (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                              uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_or (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_and (object, value);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+
+  // The unsigned type with the size of T, as used by LDREX/STREX.
+  template <typename T>
+  using exclusive_t = std::conditional_t<
+      sizeof (T) == 1, uint8_t,
+      std::conditional_t<sizeof (T) == 2, uint16_t, uint32_t>>;
+
+  template <typename T, typename F>
+  inline __attribute__ ((always_inline)) T
+  update (volatile T* object, F operation)
+  {
+    static_assert (std::is_integral_v<T>
+                       && (sizeof (T) == 1 || sizeof (T) == 2
+                           || sizeof (T) == 4),
+                   "Only 8, 16 and 32-bit integers");
+
+    T previous;
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    auto address = reinterpret_cast<volatile exclusive_t<T>*> (object);
+    do
+      {
+        previous = static_cast<T> (ldrex (address));
+      }
+    while (strex (static_cast<exclusive_t<T>> (operation (previous)), address)
+           != 0);
+#else
+    uint32_t primask = interrupts::primask ();
+    interrupts::disable ();
+    previous = *object;
+    *object = operation (previous);
+    interrupts::primask (primask);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    return previous;
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) bool
+  compare_exchange (volatile T* object, T& expected, T desired)
+  {
+    static_assert (std::is_integral_v<T>
+                       && (sizeof (T) == 1 || sizeof (T) == 2
+                           || sizeof (T) == 4),
+                   "Only 8, 16 and 32-bit integers");
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    auto address = reinterpret_cast<volatile exclusive_t<T>*> (object);
+    do
+      {
+        T current = static_cast<T> (ldrex (address));
+        if (current != expected)
+          {
+            clrex ();
+            expected = current;
+            return false;
+          }
+      }
+    while (strex (static_cast<exclusive_t<T>> (desired), address) != 0);
+    return true;
+#else
+    uint32_t primask = interrupts::primask ();
+    interrupts::disable ();
+    T current = *object;
+    bool result = (current == expected);
+    if (result)
+      {
+        *object = desired;
+      }
+    else
+      {
+        expected = current;
+      }
+    interrupts::primask (primask);
+    return result;
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  exchange (volatile T* object, T value)
+  {
+    return update (object, [value] (T) { return value; });
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_add (volatile T* object, T value)
+  {
+    return update (object, [value] (T previous) {
+      return static_cast<T> (previous + value);
+    });
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_sub (volatile T* object, T value)
+  {
+    return update (object, [value] (T previous) {
+      return static_cast<T> (previous - value);
+    });
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_or (volatile T* object, T value)
+  {
+    return update (object, [value] (T previous) {
+      return static_cast<T> (previous | value);
+    });
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_and (volatile T* object, T value)
+  {
+    return update (object, [value] (T previous) {
+      return static_cast<T> (previous & value);
+    });
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::atomic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
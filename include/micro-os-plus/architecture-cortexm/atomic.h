@@ -0,0 +1,188 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the Cortex-M lock-free atomic operations.
+//
+// They are implemented with LDREX/STREX loops, and with short
+// sequences with interrupts disabled (PRIMASK) on ARMv6-M; they do not
+// include memory barriers, which are not needed between the threads
+// and the interrupts of a single core.
+//
+// The read-modify-write functions return the previous value.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Architecture atomic operations in C, on words.
+
+  /**
+   * If `*object` is `*expected`, store `desired` and return true;
+   * otherwise store the current value in `*expected` and return false.
+   */
+  static bool
+  cortexm_architecture_atomic_compare_exchange (volatile uint32_t* object,
+                                                uint32_t* expected,
+                                                uint32_t desired);
+
+  /**
+   * Store `value`.
+   */
+  static uint32_t
+  cortexm_architecture_atomic_exchange (volatile uint32_t* object,
+                                        uint32_t value);
+
+  /**
+   * Add `value`.
+   */
+  static uint32_t
+  cortexm_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                         uint32_t value);
+
+  /**
+   * Subtract `value`.
+   */
+  static uint32_t
+  cortexm_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                         uint32_t value);
+
+  /**
+   * Bitwise or with `value`.
+   */
+  static uint32_t
+  cortexm_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                        uint32_t value);
+
+  /**
+   * Bitwise and with `value`.
+   */
+  static uint32_t
+  cortexm_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                         uint32_t value);
+
+  // --------------------------------------------------------------------------
+  // Portable architecture atomic operations in C, on words.
+
+  static bool
+  micro_os_plus_architecture_atomic_compare_exchange (
+      volatile uint32_t* object, uint32_t* expected, uint32_t desired);
+
+  static uint32_t
+  micro_os_plus_architecture_atomic_exchange (volatile uint32_t* object,
+                                              uint32_t value);
+
+  static uint32_t
+  micro_os_plus_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                               uint32_t value);
+
+  static uint32_t
+  micro_os_plus_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                               uint32_t value);
+
+  static uint32_t
+  micro_os_plus_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                              uint32_t value);
+
+  static uint32_t
+  micro_os_plus_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                               uint32_t value);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+  // Architecture atomic operations in C++, on 8, 16 and 32-bit integers.
+
+  /**
+   * Store `operation (previous)` and return the previous value; the
+   * operation may be called several times, it must have no side effects.
+   */
+  template <typename T, typename F>
+  T
+  update (volatile T* object, F operation);
+
+  /**
+   * If `*object` is `expected`, store `desired` and return true;
+   * otherwise update `expected` with the current value and return false.
+   */
+  template <typename T>
+  bool
+  compare_exchange (volatile T* object, T& expected, T desired);
+
+  template <typename T>
+  T
+  exchange (volatile T* object, T value);
+
+  template <typename T>
+  T
+  fetch_add (volatile T* object, T value);
+
+  template <typename T>
+  T
+  fetch_sub (volatile T* object, T value);
+
+  template <typename T>
+  T
+  fetch_or (volatile T* object, T value);
+
+  template <typename T>
+  T
+  fetch_and (volatile T* object, T value);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::atomic
+
+namespace micro_os_plus::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+  // Portable architecture atomic operations in C++.
+
+  using cortexm::architecture::atomic::compare_exchange;
+  using cortexm::architecture::atomic::exchange;
+  using cortexm::architecture::atomic::fetch_add;
+  using cortexm::architecture::atomic::fetch_and;
+  using cortexm::architecture::atomic::fetch_or;
+  using cortexm::architecture::atomic::fetch_sub;
+  using cortexm::architecture::atomic::update;
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::atomic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_ATOMIC_H_
+
+// ----------------------------------------------------------------------------
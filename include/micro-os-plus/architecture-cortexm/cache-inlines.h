@@ -0,0 +1,296 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  // Apply the operation to all lines of the L1 data cache. Called
+  // also with the cache disabled, when the stack may not be coherent
+  // with it; the loop variables are expected to stay in registers.
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_by_set_way (volatile uint32_t* operation)
+  {
+    CORTEXM_ARCHITECTURE_SCB_CSSELR = 0;
+    cortexm_architecture_dsb ();
+
+    uint32_t ccsidr = CORTEXM_ARCHITECTURE_SCB_CCSIDR;
+    uint32_t sets = CORTEXM_ARCHITECTURE_SCB_CCSIDR_SETS (ccsidr);
+    uint32_t ways = CORTEXM_ARCHITECTURE_SCB_CCSIDR_WAYS (ccsidr);
+    // The set index starts after the line offset, the way index is
+    // in the top bits.
+    uint32_t set_shift = (ccsidr & 0x7UL) + 4;
+    uint32_t way_shift = (ways > 1) ? (uint32_t)__builtin_clz (ways - 1) : 0;
+
+    for (uint32_t set = 0; set < sets; ++set)
+      {
+        for (uint32_t way = 0; way < ways; ++way)
+          {
+            *operation = (way << way_shift) | (set << set_shift);
+          }
+      }
+
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  // Apply the operation to the lines which overlap the range.
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_by_address (volatile uint32_t* operation,
+                                                const void* address,
+                                                size_t size)
+  {
+    if ((CORTEXM_ARCHITECTURE_SCB_CCR & CORTEXM_ARCHITECTURE_SCB_CCR_DC) == 0
+        || size == 0)
+      {
+        return;
+      }
+
+    uint32_t line = (uint32_t)address
+                    & ~((uint32_t)CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE - 1);
+    uint32_t end = (uint32_t)address + (uint32_t)size;
+
+    // The previous writes reach the cache before it is cleaned.
+    cortexm_architecture_dsb ();
+    for (; line < end; line += CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE)
+      {
+        *operation = line;
+      }
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_icache_enable (void)
+  {
+    if (CORTEXM_ARCHITECTURE_SCB_CCR & CORTEXM_ARCHITECTURE_SCB_CCR_IC)
+      {
+        return;
+      }
+
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+    CORTEXM_ARCHITECTURE_SCB_ICIALLU = 0;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+    CORTEXM_ARCHITECTURE_SCB_CCR
+        = CORTEXM_ARCHITECTURE_SCB_CCR | CORTEXM_ARCHITECTURE_SCB_CCR_IC;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_icache_disable (void)
+  {
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+    CORTEXM_ARCHITECTURE_SCB_CCR
+        = CORTEXM_ARCHITECTURE_SCB_CCR & ~CORTEXM_ARCHITECTURE_SCB_CCR_IC;
+    CORTEXM_ARCHITECTURE_SCB_ICIALLU = 0;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_icache_invalidate (void)
+  {
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+    CORTEXM_ARCHITECTURE_SCB_ICIALLU = 0;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_enable (void)
+  {
+    if (CORTEXM_ARCHITECTURE_SCB_CCR & CORTEXM_ARCHITECTURE_SCB_CCR_DC)
+      {
+        return;
+      }
+
+    // The content is random after reset.
+    cortexm_architecture_cache_dcache_by_set_way (
+        &CORTEXM_ARCHITECTURE_SCB_DCISW);
+    CORTEXM_ARCHITECTURE_SCB_CCR
+        = CORTEXM_ARCHITECTURE_SCB_CCR | CORTEXM_ARCHITECTURE_SCB_CCR_DC;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_disable (void)
+  {
+    cortexm_architecture_dsb ();
+    CORTEXM_ARCHITECTURE_SCB_CCR
+        = CORTEXM_ARCHITECTURE_SCB_CCR & ~CORTEXM_ARCHITECTURE_SCB_CCR_DC;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_cache_dcache_by_set_way (
+        &CORTEXM_ARCHITECTURE_SCB_DCCISW);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_invalidate (void)
+  {
+    cortexm_architecture_cache_dcache_by_set_way (
+        &CORTEXM_ARCHITECTURE_SCB_DCISW);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_clean (void)
+  {
+    cortexm_architecture_cache_dcache_by_set_way (
+        &CORTEXM_ARCHITECTURE_SCB_DCCSW);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_clean_invalidate (void)
+  {
+    cortexm_architecture_cache_dcache_by_set_way (
+        &CORTEXM_ARCHITECTURE_SCB_DCCISW);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_invalidate_range (void* address,
+                                                      size_t size)
+  {
+    cortexm_architecture_cache_dcache_by_address (
+        &CORTEXM_ARCHITECTURE_SCB_DCIMVAC, address, size);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_clean_range (const void* address,
+                                                 size_t size)
+  {
+    cortexm_architecture_cache_dcache_by_address (
+        &CORTEXM_ARCHITECTURE_SCB_DCCMVAC, address, size);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_cache_dcache_clean_invalidate_range (void* address,
+                                                            size_t size)
+  {
+    cortexm_architecture_cache_dcache_by_address (
+        &CORTEXM_ARCHITECTURE_SCB_DCCIMVAC, address, size);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::cache
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  icache_enable (void)
+  {
+    cortexm_architecture_cache_icache_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  icache_disable (void)
+  {
+    cortexm_architecture_cache_icache_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  icache_invalidate (void)
+  {
+    cortexm_architecture_cache_icache_invalidate ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_enable (void)
+  {
+    cortexm_architecture_cache_dcache_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_disable (void)
+  {
+    cortexm_architecture_cache_dcache_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_invalidate (void)
+  {
+    cortexm_architecture_cache_dcache_invalidate ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_clean (void)
+  {
+    cortexm_architecture_cache_dcache_clean ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_clean_invalidate (void)
+  {
+    cortexm_architecture_cache_dcache_clean_invalidate ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_invalidate (void* address, size_t size)
+  {
+    cortexm_architecture_cache_dcache_invalidate_range (address, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_clean (const void* address, size_t size)
+  {
+    cortexm_architecture_cache_dcache_clean_range (address, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dcache_clean_invalidate (void* address, size_t size)
+  {
+    cortexm_architecture_cache_dcache_clean_invalidate_range (address, size);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::cache
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_INLINES_H_
+
+// ----------------------------------------------------------------------------
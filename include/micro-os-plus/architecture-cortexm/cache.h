@@ -0,0 +1,188 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stddef.h>
+
+// ----------------------------------------------------------------------------
+// L1 cache maintenance (Cortex-M7, Cortex-M55/M85), on ARMv7-M and
+// ARMv8-M Mainline.
+//
+// The operations by address work on whole lines
+// (CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE): the range is extended down
+// and up to the line boundaries, so the DMA buffers must be aligned to
+// lines, not to share them with other data. They do nothing while the
+// data cache is disabled, which includes the cores without caches.
+//
+// For DMA: clean before the transfers from memory, invalidate after
+// the transfers to memory. The buffers in `.noncacheable` (see
+// MICRO_OS_PLUS_NONCACHEABLE) need neither.
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Cache maintenance in C.
+
+  /**
+   * Invalidate and enable the instruction cache.
+   */
+  static void
+  cortexm_architecture_cache_icache_enable (void);
+
+  /**
+   * Disable and invalidate the instruction cache.
+   */
+  static void
+  cortexm_architecture_cache_icache_disable (void);
+
+  /**
+   * Invalidate the instruction cache, for example after code was
+   * written to RAM.
+   */
+  static void
+  cortexm_architecture_cache_icache_invalidate (void);
+
+  /**
+   * Invalidate the whole data cache, by set/way, and enable it.
+   */
+  static void
+  cortexm_architecture_cache_dcache_enable (void);
+
+  /**
+   * Disable the data cache and write back its dirty lines.
+   */
+  static void
+  cortexm_architecture_cache_dcache_disable (void);
+
+  /**
+   * Invalidate the whole data cache, by set/way; the dirty lines are
+   * lost.
+   */
+  static void
+  cortexm_architecture_cache_dcache_invalidate (void);
+
+  /**
+   * Write back the whole data cache, by set/way.
+   */
+  static void
+  cortexm_architecture_cache_dcache_clean (void);
+
+  /**
+   * Write back and invalidate the whole data cache, by set/way.
+   */
+  static void
+  cortexm_architecture_cache_dcache_clean_invalidate (void);
+
+  /**
+   * Invalidate the lines of the range, after a DMA transfer to memory
+   * and before the CPU reads it.
+   */
+  static void
+  cortexm_architecture_cache_dcache_invalidate_range (void* address,
+                                                      size_t size);
+
+  /**
+   * Write back the lines of the range, before a DMA transfer from
+   * memory.
+   */
+  static void
+  cortexm_architecture_cache_dcache_clean_range (const void* address,
+                                                 size_t size);
+
+  /**
+   * Write back and invalidate the lines of the range, for the buffers
+   * used in both directions.
+   */
+  static void
+  cortexm_architecture_cache_dcache_clean_invalidate_range (void* address,
+                                                            size_t size);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::cache
+{
+  // --------------------------------------------------------------------------
+  // Cache maintenance in C++.
+
+  void
+  icache_enable (void);
+
+  void
+  icache_disable (void);
+
+  void
+  icache_invalidate (void);
+
+  void
+  dcache_enable (void);
+
+  void
+  dcache_disable (void);
+
+  void
+  dcache_invalidate (void);
+
+  void
+  dcache_clean (void);
+
+  void
+  dcache_clean_invalidate (void);
+
+  /**
+   * Invalidate the lines of the range (after a DMA write).
+   */
+  void
+  dcache_invalidate (void* address, size_t size);
+
+  /**
+   * Write back the lines of the range (before a DMA read).
+   */
+  void
+  dcache_clean (const void* address, size_t size);
+
+  /**
+   * Write back and invalidate the lines of the range.
+   */
+  void
+  dcache_clean_invalidate (void* address, size_t size);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::cache
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CACHE_H_
+
+// ----------------------------------------------------------------------------
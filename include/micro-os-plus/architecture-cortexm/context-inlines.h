@@ -0,0 +1,102 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the Cortex-M context switch.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_context_switch_request (void)
+  {
+    // The other ICSR bits are ignored when written with 0.
+    CORTEXM_ARCHITECTURE_SCB_ICSR = CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSVSET;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_context_set_stack_limit (uint32_t* stack_bottom)
+  {
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+    // Called in handler mode, on MSP, where PSPLIM is not checked.
+    cortexm_architecture_set_psplim (
+        (cortexm_architecture_register_t)stack_bottom);
+#else
+    (void)stack_bottom;
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::context
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) uint32_t*
+  initialize_stack (uint32_t* stack_top, void (*entry) (void*),
+                    void* argument, void (*exit) (void))
+  {
+    return cortexm_architecture_context_initialize_stack (stack_top, entry,
+                                                          argument, exit);
+  }
+
+  [[noreturn]] inline __attribute__ ((always_inline)) void
+  start (uint32_t* stack_pointer)
+  {
+    cortexm_architecture_context_start (stack_pointer);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  switch_request (void)
+  {
+    cortexm_architecture_context_switch_request ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  set_stack_limit (uint32_t* stack_bottom)
+  {
+    cortexm_architecture_context_set_stack_limit (stack_bottom);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::context
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_INLINES_H_
+
+// ----------------------------------------------------------------------------
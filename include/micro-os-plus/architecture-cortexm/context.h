@@ -0,0 +1,228 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// The thread context switch, for schedulers running the threads in
+// thread mode on PSP, with the handlers on MSP.
+//
+// When MICRO_OS_PLUS_ARCHITECTURE_CONTEXT_SWITCH is defined, `src/context.c`
+// provides the PendSV and SVC handlers. PendSV saves r4-r11 and
+// EXC_RETURN on the thread stack, below the exception frame pushed by
+// the hardware, and, only if the thread used the FPU (EXC_RETURN bit 4
+// cleared, extended frame), s16-s31 between them; s0-s15 and FPSCR are
+// part of the extended frame, lazily stacked by the hardware. The
+// scheduler only exchanges the stack pointers, via
+// `cortexm_architecture_context_switch_hook()`.
+//
+// The thread stack, from the lower addresses:
+//
+//   cortexm_architecture_context_saved_t      r4-r11, EXC_RETURN
+//   cortexm_architecture_context_fpu_saved_t  s16-s31 (extended only)
+//   cortexm_architecture_context_exception_frame_t or
+//   cortexm_architecture_context_extended_exception_frame_t
+
+// EXC_RETURN bits.
+#define CORTEXM_ARCHITECTURE_EXC_RETURN_DCRS (1UL << 5) // 0: +r4-r11, v8-M
+#define CORTEXM_ARCHITECTURE_EXC_RETURN_FTYPE (1UL << 4) // 0: extended
+#define CORTEXM_ARCHITECTURE_EXC_RETURN_MODE (1UL << 3) // 1: thread
+#define CORTEXM_ARCHITECTURE_EXC_RETURN_SPSEL (1UL << 2) // 1: PSP
+
+// Return to thread mode, on PSP, with a basic frame; TrustZone
+// non-secure builds on ARMv8-M must define it as 0xFFFFFFBC.
+#if !defined(CORTEXM_ARCHITECTURE_CONTEXT_INITIAL_EXC_RETURN)
+#define CORTEXM_ARCHITECTURE_CONTEXT_INITIAL_EXC_RETURN (0xFFFFFFFDUL)
+#endif
+
+// The Thumb state bit, which must be set in the initial xPSR.
+#define CORTEXM_ARCHITECTURE_XPSR_T (1UL << 24)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * The basic exception frame, pushed by the hardware.
+   */
+  typedef struct cortexm_architecture_context_exception_frame_s
+  {
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;
+    uint32_t xpsr;
+  } cortexm_architecture_context_exception_frame_t;
+
+  /**
+   * The extended exception frame, pushed by the hardware when the
+   * thread used the FPU (CONTROL.FPCA set).
+   */
+  typedef struct cortexm_architecture_context_extended_exception_frame_s
+  {
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;
+    uint32_t xpsr;
+    uint32_t s[16];
+    uint32_t fpscr;
+    uint32_t reserved;
+  } cortexm_architecture_context_extended_exception_frame_t;
+
+  /**
+   * The FP callee-saved registers, saved by PendSV only for the
+   * extended frames.
+   */
+  typedef struct cortexm_architecture_context_fpu_saved_s
+  {
+    uint32_t s[16]; // s16-s31
+  } cortexm_architecture_context_fpu_saved_t;
+
+  /**
+   * The callee-saved registers, saved by PendSV; the saved stack
+   * pointer points here.
+   */
+  typedef struct cortexm_architecture_context_saved_s
+  {
+    uint32_t r4;
+    uint32_t r5;
+    uint32_t r6;
+    uint32_t r7;
+    uint32_t r8;
+    uint32_t r9;
+    uint32_t r10;
+    uint32_t r11;
+    uint32_t exc_return;
+  } cortexm_architecture_context_saved_t;
+
+  // --------------------------------------------------------------------------
+  // Context switch in C.
+
+  /**
+   * Prepare the stack of a new thread, such that the first switch
+   * to it calls `entry (argument)`, and `exit()` when it returns;
+   * return the stack pointer, to be passed to the switch.
+   */
+  uint32_t*
+  cortexm_architecture_context_initialize_stack (uint32_t* stack_top,
+                                                 void (*entry) (void*),
+                                                 void* argument,
+                                                 void (*exit) (void));
+
+  /**
+   * Set PendSV to the lowest priority and start the first thread
+   * via SVC; the main stack is reset to its initial top and used
+   * only by the handlers, and the FP context of main(), if any, is
+   * dropped. Does not return.
+   */
+  void __attribute__ ((noreturn))
+  cortexm_architecture_context_start (uint32_t* stack_pointer);
+
+  /**
+   * Pend PendSV; the switch is performed after all other handlers
+   * return.
+   */
+  static void
+  cortexm_architecture_context_switch_request (void);
+
+  /**
+   * Set the stack limit of the thread to run, to be called from the
+   * switch hook and before the start, with the lowest address of its
+   * stack; on ARMv8-M it sets PSPLIM, so an overflow raises a fault
+   * (see `cortexm_architecture_stack_overflow_handler()`), on the
+   * other architectures it does nothing.
+   */
+  static void
+  cortexm_architecture_context_set_stack_limit (uint32_t* stack_bottom);
+
+  /**
+   * Implemented by the scheduler; called from PendSV, with the
+   * interrupts masked by a critical section, with the stack pointer
+   * of the current thread, after saving its context. Return the stack
+   * pointer of the thread to run (the same for no switch).
+   */
+  extern uint32_t*
+  cortexm_architecture_context_switch_hook (uint32_t* stack_pointer);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::context
+{
+  // --------------------------------------------------------------------------
+  // Context switch in C++.
+
+  using exception_frame_t = cortexm_architecture_context_exception_frame_t;
+  using extended_exception_frame_t
+      = cortexm_architecture_context_extended_exception_frame_t;
+  using fpu_saved_t = cortexm_architecture_context_fpu_saved_t;
+  using saved_t = cortexm_architecture_context_saved_t;
+
+  /**
+   * Prepare the stack of a new thread.
+   */
+  uint32_t*
+  initialize_stack (uint32_t* stack_top, void (*entry) (void*),
+                    void* argument, void (*exit) (void));
+
+  /**
+   * Start the first thread. Does not return.
+   */
+  [[noreturn]] void
+  start (uint32_t* stack_pointer);
+
+  /**
+   * Pend PendSV.
+   */
+  void
+  switch_request (void);
+
+  /**
+   * Set the stack limit of the thread to run (PSPLIM on ARMv8-M).
+   */
+  void
+  set_stack_limit (uint32_t* stack_bottom);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::context
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CONTEXT_H_
+
+// ----------------------------------------------------------------------------
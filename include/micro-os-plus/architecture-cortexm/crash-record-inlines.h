@@ -0,0 +1,43 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::crash_record
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) bool
+  retrieve (record_t& record)
+  {
+    return cortexm_architecture_crash_record_retrieve (&record);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::crash_record
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,124 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/context.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Post-mortem crash record, when MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD
+// is defined.
+//
+// The fault handlers in `src/crash-record.c` (or, with
+// MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS, those in `src/fault.c`,
+// for the faults not resumed) copy the exception frame,
+// the fault status registers and a few words of the stack into a
+// record in `.noinit`, protected by a checksum, and reset the device
+// at once, without printing anything; after the restart, the
+// application retrieves the record and logs it at its leisure.
+
+// The number of stack words saved above the exception frame.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD_STACK_WORDS)
+#define MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD_STACK_WORDS (16)
+#endif
+
+#define CORTEXM_ARCHITECTURE_CRASH_RECORD_MAGIC (0x48535243UL) // "CRSH"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef struct cortexm_architecture_crash_record_s
+  {
+    uint32_t magic;
+    // The number of crashes since the record was last retrieved.
+    uint32_t count;
+    // The IPSR exception number (3 for HardFault, etc).
+    uint32_t exception;
+    uint32_t exc_return;
+    // The active stack pointer, where the frame was pushed.
+    uint32_t stack_pointer;
+    // The basic part of the frame; zero if the stack pointer was not
+    // valid.
+    cortexm_architecture_context_exception_frame_t frame;
+    // Zero on ARMv6-M and ARMv8-M Baseline.
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+    // The words above the frame, up to the top of the main stack.
+    uint32_t stack[MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD_STACK_WORDS];
+    uint32_t checksum;
+  } cortexm_architecture_crash_record_t;
+
+  // --------------------------------------------------------------------------
+  // Crash record in C.
+
+  /**
+   * Fill the record from the given frame and reset the device; called
+   * by the fault handlers, or by the application handlers which want
+   * the same treatment.
+   */
+  void __attribute__ ((noreturn))
+  cortexm_architecture_crash_record_save (uint32_t* stack_pointer,
+                                          uint32_t exc_return);
+
+  /**
+   * If a valid record was left by a crash before the last reset, copy
+   * it and invalidate it. Returns true if a record was copied.
+   */
+  bool
+  cortexm_architecture_crash_record_retrieve (
+      cortexm_architecture_crash_record_t* record);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::crash_record
+{
+  // --------------------------------------------------------------------------
+  // Crash record in C++.
+
+  using record_t = cortexm_architecture_crash_record_t;
+
+  /**
+   * Copy and invalidate the record left by a crash, if any.
+   */
+  bool
+  retrieve (record_t& record);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::crash_record
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CRASH_RECORD_H_
+
+// ----------------------------------------------------------------------------
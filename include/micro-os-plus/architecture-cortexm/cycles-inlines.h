@@ -0,0 +1,145 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the Cortex-M cycle counter.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_cycles_read (void)
+  {
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+    return cortexm_architecture_cycles_systick_read ();
+#else
+    return CORTEXM_ARCHITECTURE_DWT_CYCCNT;
+#endif
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  micro_os_plus_architecture_cycles_enable (void)
+  {
+    return cortexm_architecture_cycles_enable ();
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_cycles_read (void)
+  {
+    return cortexm_architecture_cycles_read ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_cycles_reset (void)
+  {
+    cortexm_architecture_cycles_reset ();
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  micro_os_plus_architecture_cycles_read64 (void)
+  {
+    return cortexm_architecture_cycles_read64 ();
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::cycles
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) bool
+  enable (void)
+  {
+    return cortexm_architecture_cycles_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  read (void)
+  {
+    return cortexm_architecture_cycles_read ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  reset (void)
+  {
+    cortexm_architecture_cycles_reset ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  read64 (void)
+  {
+    return cortexm_architecture_cycles_read64 ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::cycles
+
+namespace micro_os_plus::architecture::cycles
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) bool
+  enable (void)
+  {
+    return cortexm::architecture::cycles::enable ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  read (void)
+  {
+    return cortexm::architecture::cycles::read ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  reset (void)
+  {
+    cortexm::architecture::cycles::reset ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  read64 (void)
+  {
+    return cortexm::architecture::cycles::read64 ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::cycles
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,176 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+// On the mainline profile the counter is the DWT CYCCNT; on the
+// baseline profile, or when explicitly requested (for example on
+// simulators that do not implement the DWT), SysTick is used.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+#if !defined(CORTEXM_ARCHITECTURE_IS_MAINLINE) \
+    || defined(MICRO_OS_PLUS_ARCHITECTURE_CYCLES_USE_SYSTICK)
+#define CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK
+#endif
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+
+// ----------------------------------------------------------------------------
+// Declarations of the Cortex-M cycle counter functions.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Architecture cycle counter in C.
+
+  /**
+   * Enable the cycle counter.
+   *
+   * With the DWT, enable the trace block and start CYCCNT.
+   * With SysTick, if not already running, start it free running
+   * from the core clock, without interrupts.
+   *
+   * Return true if the counter is running.
+   */
+  bool
+  cortexm_architecture_cycles_enable (void);
+
+  /**
+   * Get the current 32-bit cycle count.
+   */
+  static uint32_t
+  cortexm_architecture_cycles_read (void);
+
+  /**
+   * Restart the cycle count from zero.
+   *
+   * The intervals being measured when it is called, for example by
+   * a handler between the IRQ statistics hooks, or by the function
+   * profiler, end with a count lower than the start and are wrong;
+   * call it before starting the measurements, not while they run.
+   */
+  void
+  cortexm_architecture_cycles_reset (void);
+
+  /**
+   * Get the 64-bit extended cycle count.
+   *
+   * Safe to call from both threads and interrupts. To detect all
+   * 32-bit wraps (and the shorter SysTick wraps), it must be called
+   * at least once per wrap period.
+   */
+  uint64_t
+  cortexm_architecture_cycles_read64 (void);
+
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+  /**
+   * Extend the 24-bit SysTick down counter to 32-bit. Not inlined.
+   */
+  uint32_t
+  cortexm_architecture_cycles_systick_read (void);
+#endif // defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+
+  // --------------------------------------------------------------------------
+  // Portable architecture cycle counter in C.
+
+  static bool
+  micro_os_plus_architecture_cycles_enable (void);
+
+  static uint32_t
+  micro_os_plus_architecture_cycles_read (void);
+
+  static void
+  micro_os_plus_architecture_cycles_reset (void);
+
+  static uint64_t
+  micro_os_plus_architecture_cycles_read64 (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::cycles
+{
+  // --------------------------------------------------------------------------
+  // Architecture cycle counter in C++.
+
+  /**
+   * Enable the cycle counter; return true if running.
+   */
+  bool
+  enable (void);
+
+  /**
+   * Get the current 32-bit cycle count.
+   */
+  uint32_t
+  read (void);
+
+  /**
+   * Restart the cycle count from zero.
+   */
+  void
+  reset (void);
+
+  /**
+   * Get the 64-bit extended cycle count.
+   */
+  uint64_t
+  read64 (void);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::cycles
+
+namespace micro_os_plus::architecture::cycles
+{
+  // --------------------------------------------------------------------------
+  // Portable architecture cycle counter in C++.
+
+  bool
+  enable (void);
+
+  uint32_t
+  read (void);
+
+  void
+  reset (void);
+
+  uint64_t
+  read64 (void);
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::cycles
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_CYCLES_H_
+
+// ----------------------------------------------------------------------------
@@ -18,6 +18,78 @@
 #define MICRO_OS_PLUS_HAS_INTERRUPTS_STACK
 #define MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC (0xEFBEADDE)
 
+// ----------------------------------------------------------------------------
+// Architecture profiles.
+
+// The mainline profile (ARMv7-M, ARMv7E-M, ARMv8-M Mainline, ARMv8.1-M)
+// has BASEPRI, exclusive accesses, the DWT cycle counter, etc.
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) \
+    || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+#define CORTEXM_ARCHITECTURE_IS_MAINLINE
+#endif
+
+// The baseline profile (ARMv6-M, ARMv8-M Baseline) has only the
+// minimal set of system registers and instructions.
+#if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+#define CORTEXM_ARCHITECTURE_IS_BASELINE
+#endif
+
+// LDREX/STREX/CLREX, for bytes, half-words and words; all but ARMv6-M.
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE) || defined(__ARM_ARCH_8M_BASE__)
+#define CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+#endif
+
+// The MSPLIM/PSPLIM stack limit registers; on ARMv8-M Baseline
+// without the Security Extension they read as zero and ignore writes.
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__) \
+    || defined(__ARM_ARCH_8M_BASE__)
+#define CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS
+#endif
+
+// The Vector Table Offset Register; optional on ARMv6-M (present on
+// most Cortex-M0+, absent on Cortex-M0), so not used there.
+#if !defined(__ARM_ARCH_6M__)
+#define CORTEXM_ARCHITECTURE_HAS_VTOR
+#endif
+
+// The floating point unit (Cortex-M4F/M7/M33/M55...), when the
+// compiler is allowed to use it; the exception frames may then be
+// extended with the FP registers.
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE) && defined(__ARM_FP)
+#define CORTEXM_ARCHITECTURE_HAS_FPU
+#endif
+
+// The data cache line size (Cortex-M7, Cortex-M55/M85), used to align
+// the buffers shared with DMA; harmless on the cores without cache.
+#if !defined(CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE)
+#define CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE (32)
+#endif
+
+// ----------------------------------------------------------------------------
+// Placement in the tightly coupled memories, defined by the linker
+// scripts; the startup copies/clears them together with .data/.bss.
+// On devices without them, the regions are aliased to RAM.
+
+// Functions executed from ITCM, for interrupt handlers and DSP loops;
+// not inlined, to keep them where requested.
+#define MICRO_OS_PLUS_FAST_CODE \
+  __attribute__ ((section (".fast_text"), noinline))
+
+// Initialised variables in DTCM.
+#define MICRO_OS_PLUS_FAST_DATA __attribute__ ((section (".dtcm_data")))
+
+// Zero initialised variables in DTCM.
+#define MICRO_OS_PLUS_FAST_BSS __attribute__ ((section (".dtcm_bss")))
+
+// Variables in CCM, not initialised.
+#define MICRO_OS_PLUS_CCM_NOINIT __attribute__ ((section (".ccm_noinit")))
+
+// Buffers shared with DMA, in RAM, not initialised; not cached if the
+// application maps `.noncacheable` with a non-cacheable MPU region.
+#define MICRO_OS_PLUS_NONCACHEABLE \
+  __attribute__ ((section (".noncacheable"), \
+                  aligned (CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE)))
+
 // ----------------------------------------------------------------------------
 
 #endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_DEFINES_H_
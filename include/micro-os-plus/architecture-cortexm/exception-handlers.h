@@ -25,6 +25,8 @@ extern "C"
 #endif
 
   // External references to Cortex-M exception_handlers.c
+  // SysTick and the device interrupt handlers can be measured with
+  // the hooks in `irq-statistics.h`.
 
   extern void
   Reset_Handler (void);
@@ -33,7 +35,8 @@ extern "C"
   extern void
   HardFault_Handler (void);
 
-#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) \
+    || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
   extern void
   MemManage_Handler (void);
   extern void
@@ -52,7 +55,16 @@ extern "C"
   extern void
   SysTick_Handler (void);
 
+  // The handler of the vectors without a specific one; with
+  // MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS, also of the RAM table
+  // entries past `.interrupt_vectors`.
+  extern void
+  Default_Handler (void);
+
   // Exception Stack Frame of the Cortex-M3 or Cortex-M4 processors.
+  // The s[] registers are present only if the frame is extended,
+  // which is known only at run time; use
+  // `cortexm_architecture_fault_decode()` to locate the parts.
   typedef struct
   {
     uint32_t r0;
@@ -92,6 +104,22 @@ extern "C"
   bus_fault_handler_c (exception_stack_frame_s* frame, uint32_t lr);
 #endif // defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
 
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+  // With MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMITS, the UsageFault
+  // handler in src/stack-overflow.c calls them, with the EXC_RETURN
+  // value (bit 2 set if on the process stack). For stack overflows
+  // (STKOF) the exception frame is incomplete, so the handler must not
+  // return to the faulty context; switching to another thread is fine.
+  // The default (weak) definitions wait forever. With
+  // MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS, the other usage faults
+  // go to `cortexm_architecture_fault_handler()`, and
+  // `cortexm_architecture_usage_fault_handler()` is not used.
+  void
+  cortexm_architecture_stack_overflow_handler (uint32_t exc_return);
+  void
+  cortexm_architecture_usage_fault_handler (uint32_t exc_return);
+#endif // defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+
 #if defined(__cplusplus)
 }
 #endif
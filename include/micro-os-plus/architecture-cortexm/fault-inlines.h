@@ -0,0 +1,107 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_fault_instruction_size (uint32_t address)
+  {
+    // The first half-word of the 32-bit instructions starts with
+    // 0b11101, 0b11110 or 0b11111.
+    uint16_t half_word = *(const uint16_t*)address;
+    return ((half_word & 0xF800) >= 0xE800) ? 4 : 2;
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  cortexm_architecture_fault_is_executable (uint32_t address)
+  {
+    // Code and SRAM, 0x00000000-0x3FFFFFFF; RAM, 0x60000000-0x9FFFFFFF.
+    return (address & 1) == 0
+           && (address < 0x40000000
+               || (address >= 0x60000000 && address < 0xA0000000));
+  }
+
+  static inline __attribute__ ((always_inline)) bool
+  cortexm_architecture_fault_skip_instruction (
+      cortexm_architecture_fault_frame_t* frame,
+      const cortexm_architecture_fault_status_t* status)
+  {
+    // The instruction was not fetched, or not in the Thumb state;
+    // reading it may fault again, in the handler.
+    if ((status->cfsr
+         & (CORTEXM_ARCHITECTURE_SCB_CFSR_IACCVIOL
+            | CORTEXM_ARCHITECTURE_SCB_CFSR_IBUSERR
+            | CORTEXM_ARCHITECTURE_SCB_CFSR_INVSTATE))
+            != 0
+        || !cortexm_architecture_fault_is_executable (frame->basic->pc))
+      {
+        return false;
+      }
+
+    frame->basic->pc
+        += cortexm_architecture_fault_instruction_size (frame->basic->pc);
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::fault
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  decode (frame_t& frame, uint32_t* stack_pointer, uint32_t exc_return)
+  {
+    cortexm_architecture_fault_decode (&frame, stack_pointer, exc_return);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  skip_instruction (frame_t& frame, const status_t& status)
+  {
+    return cortexm_architecture_fault_skip_instruction (&frame, &status);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::fault
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/context.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Exception frame decoding and fault handlers.
+//
+// The layout of the frame is known only at run time, from EXC_RETURN:
+// basic (8 words) or, on the cores with FPU, extended with s0-s15,
+// FPSCR and a reserved word (bit 4 cleared); on ARMv8-M, for the
+// secure handlers, preceded by the integrity signature and r4-r11
+// (bit 5 cleared); followed by an alignment word if bit 9 of the
+// stacked xPSR is set.
+//
+// When MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS is defined,
+// `src/fault.c` provides the HardFault (and, on mainline, MemManage,
+// BusFault and UsageFault) handlers, which decode the frame and call
+// `cortexm_architecture_fault_handler()`; if it returns true, the
+// fault status is cleared and the faulty context resumes.
+
+#define CORTEXM_ARCHITECTURE_XPSR_ALIGNED (1UL << 9) // 1: padded
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef struct cortexm_architecture_fault_frame_s
+  {
+    // The basic part, r0-r3, r12, lr, pc, xPSR.
+    cortexm_architecture_context_exception_frame_t* basic;
+    // s0-s15 and FPSCR, for the extended frames; NULL otherwise.
+    uint32_t* fpu;
+    // The stack pointer of the interrupted code, above the frame.
+    uint32_t* caller_stack_pointer;
+    uint32_t exc_return;
+    bool extended;
+  } cortexm_architecture_fault_frame_t;
+
+  typedef struct cortexm_architecture_fault_status_s
+  {
+    // The IPSR exception number (3 for HardFault, etc).
+    uint32_t exception;
+    // Zero on ARMv6-M and ARMv8-M Baseline.
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+  } cortexm_architecture_fault_status_t;
+
+  // --------------------------------------------------------------------------
+  // Faults in C.
+
+  /**
+   * Locate the parts of the frame pushed at stack_pointer; for the
+   * extended frames with lazy stacking still pending, force the FPU
+   * registers to be stored in the frame, so s0-s15 are valid.
+   */
+  void
+  cortexm_architecture_fault_decode (cortexm_architecture_fault_frame_t* frame,
+                                     uint32_t* stack_pointer,
+                                     uint32_t exc_return);
+
+  /**
+   * The size of the Thumb instruction at address, 2 or 4 bytes.
+   */
+  static uint32_t
+  cortexm_architecture_fault_instruction_size (uint32_t address);
+
+  /**
+   * True if the address is half-word aligned and in the regions where
+   * the default memory map allows execution (Code, SRAM, external
+   * RAM).
+   */
+  static bool
+  cortexm_architecture_fault_is_executable (uint32_t address);
+
+  /**
+   * Advance the stacked PC past the faulty instruction, to resume
+   * after it; only for the precise faults (not for the imprecise
+   * BusFaults, where the PC is already further). Returns false,
+   * without changing the frame, if the instruction cannot be read:
+   * for the instruction fetch faults (CFSR IACCVIOL, IBUSERR), for
+   * INVSTATE, or if the stacked PC is not executable. On ARMv6-M and
+   * ARMv8-M Baseline, without CFSR, only the PC is checked.
+   */
+  static bool
+  cortexm_architecture_fault_skip_instruction (
+      cortexm_architecture_fault_frame_t* frame,
+      const cortexm_architecture_fault_status_t* status);
+
+  /**
+   * Implemented by the application, to be called by the handlers in
+   * `src/fault.c`; return true to resume the faulty context (possibly
+   * after changing the frame), false to stop. Faults raised while
+   * pushing the frame (CFSR STKERR, MSTKERR, STKOF) leave it
+   * incomplete and must not be resumed.
+   * The default (weak) definition returns false.
+   */
+  bool
+  cortexm_architecture_fault_handler (
+      cortexm_architecture_fault_frame_t* frame,
+      const cortexm_architecture_fault_status_t* status);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::fault
+{
+  // --------------------------------------------------------------------------
+  // Faults in C++.
+
+  using frame_t = cortexm_architecture_fault_frame_t;
+  using status_t = cortexm_architecture_fault_status_t;
+
+  /**
+   * Locate the parts of the frame pushed at stack_pointer.
+   */
+  void
+  decode (frame_t& frame, uint32_t* stack_pointer, uint32_t exc_return);
+
+  /**
+   * Advance the stacked PC past the faulty instruction, if it can be
+   * read.
+   */
+  bool
+  skip_instruction (frame_t& frame, const status_t& status);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::fault
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FAULT_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FUNCTION_PROFILE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FUNCTION_PROFILE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Function call counters, collected with `-finstrument-functions`
+// when MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS is defined, and
+// converted by `scripts/order-functions.py` into linker script
+// fragments which place the hot functions first.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Function profile in C.
+
+  /**
+   * Write the counters via semihosting, one
+   * `MICRO_OS_PLUS_PROFILE 0x<address> <count>` line per function.
+   */
+  void
+  cortexm_architecture_function_profile_dump (void);
+
+  /**
+   * Clear the counters, for example after the initialisations.
+   */
+  void
+  cortexm_architecture_function_profile_reset (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::function_profile
+{
+  // --------------------------------------------------------------------------
+  // Function profile in C++.
+
+  /**
+   * Write the counters via semihosting.
+   */
+  void
+  dump (void);
+
+  /**
+   * Clear the counters.
+   */
+  void
+  reset (void);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::function_profile
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_FUNCTION_PROFILE_H_
+
+// ----------------------------------------------------------------------------
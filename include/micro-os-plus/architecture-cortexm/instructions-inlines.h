@@ -66,6 +66,177 @@ extern "C"
     );
   }
 
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_wfe (void)
+  {
+    __asm__ volatile(
+
+        " wfe "
+
+        : /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_dmb (void)
+  {
+    __asm__ volatile(
+
+        " dmb 0xF "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_dsb (void)
+  {
+    __asm__ volatile(
+
+        " dsb 0xF "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_isb (void)
+  {
+    __asm__ volatile(
+
+        " isb 0xF "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  static inline __attribute__ ((always_inline)) uint8_t
+  cortexm_architecture_ldrexb (volatile uint8_t* address)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " ldrexb %0, %1 "
+
+        : "=r"(value) /* Outputs */
+        : "Q"(*address) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return (uint8_t)value;
+  }
+
+  static inline __attribute__ ((always_inline)) uint16_t
+  cortexm_architecture_ldrexh (volatile uint16_t* address)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " ldrexh %0, %1 "
+
+        : "=r"(value) /* Outputs */
+        : "Q"(*address) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return (uint16_t)value;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_ldrex (volatile uint32_t* address)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " ldrex %0, %1 "
+
+        : "=r"(value) /* Outputs */
+        : "Q"(*address) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return (uint32_t)value;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_strexb (uint8_t value, volatile uint8_t* address)
+  {
+    uint32_t result;
+
+    __asm__ volatile(
+
+        " strexb %0, %2, %1 "
+
+        : "=&r"(result), "=Q"(*address) /* Outputs */
+        : "r"((uint32_t)value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_strexh (uint16_t value, volatile uint16_t* address)
+  {
+    uint32_t result;
+
+    __asm__ volatile(
+
+        " strexh %0, %2, %1 "
+
+        : "=&r"(result), "=Q"(*address) /* Outputs */
+        : "r"((uint32_t)value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_strex (uint32_t value, volatile uint32_t* address)
+  {
+    uint32_t result;
+
+    __asm__ volatile(
+
+        " strex %0, %2, %1 "
+
+        : "=&r"(result), "=Q"(*address) /* Outputs */
+        : "r"((uint32_t)value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_clrex (void)
+  {
+    __asm__ volatile(
+
+        " clrex "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
   static inline __attribute__ ((always_inline)) void
   micro_os_plus_architecture_nop (void)
   {
@@ -122,6 +293,76 @@ namespace cortexm::architecture
     cortexm_architecture_wfi ();
   }
 
+  inline __attribute__ ((always_inline)) void
+  wfe (void)
+  {
+    cortexm_architecture_wfe ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dmb (void)
+  {
+    cortexm_architecture_dmb ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dsb (void)
+  {
+    cortexm_architecture_dsb ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  isb (void)
+  {
+    cortexm_architecture_isb ();
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  inline __attribute__ ((always_inline)) uint8_t
+  ldrex (volatile uint8_t* address)
+  {
+    return cortexm_architecture_ldrexb (address);
+  }
+
+  inline __attribute__ ((always_inline)) uint16_t
+  ldrex (volatile uint16_t* address)
+  {
+    return cortexm_architecture_ldrexh (address);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  ldrex (volatile uint32_t* address)
+  {
+    return cortexm_architecture_ldrex (address);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  strex (uint8_t value, volatile uint8_t* address)
+  {
+    return cortexm_architecture_strexb (value, address);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  strex (uint16_t value, volatile uint16_t* address)
+  {
+    return cortexm_architecture_strexh (value, address);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  strex (uint32_t value, volatile uint32_t* address)
+  {
+    return cortexm_architecture_strex (value, address);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clrex (void)
+  {
+    cortexm_architecture_clrex ();
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
   // --------------------------------------------------------------------------
 } // namespace cortexm::architecture
 
@@ -48,6 +48,80 @@ extern "C"
   static void
   cortexm_architecture_wfi (void);
 
+  /**
+   * `wfe` instruction.
+   */
+  static void
+  cortexm_architecture_wfe (void);
+
+  /**
+   * `dmb` instruction; complete the explicit memory accesses before
+   * the following ones; a compiler barrier too.
+   */
+  static void
+  cortexm_architecture_dmb (void);
+
+  /**
+   * `dsb` instruction; complete the memory accesses before the
+   * following instructions.
+   */
+  static void
+  cortexm_architecture_dsb (void);
+
+  /**
+   * `isb` instruction; flush the pipeline.
+   */
+  static void
+  cortexm_architecture_isb (void);
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  /**
+   * `ldrexb` instruction; load a byte and mark the address for
+   * exclusive access.
+   */
+  static uint8_t
+  cortexm_architecture_ldrexb (volatile uint8_t* address);
+
+  /**
+   * `ldrexh` instruction.
+   */
+  static uint16_t
+  cortexm_architecture_ldrexh (volatile uint16_t* address);
+
+  /**
+   * `ldrex` instruction.
+   */
+  static uint32_t
+  cortexm_architecture_ldrex (volatile uint32_t* address);
+
+  /**
+   * `strexb` instruction; store a byte if the exclusive access is
+   * still valid. Return 0 on success, 1 if not stored.
+   */
+  static uint32_t
+  cortexm_architecture_strexb (uint8_t value, volatile uint8_t* address);
+
+  /**
+   * `strexh` instruction.
+   */
+  static uint32_t
+  cortexm_architecture_strexh (uint16_t value, volatile uint16_t* address);
+
+  /**
+   * `strex` instruction.
+   */
+  static uint32_t
+  cortexm_architecture_strex (uint32_t value, volatile uint32_t* address);
+
+  /**
+   * `clrex` instruction; clear the exclusive access mark.
+   */
+  static void
+  cortexm_architecture_clrex (void);
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
   // --------------------------------------------------------------------------
   // Portable architecture assembly instructions in C.
 
@@ -102,6 +176,65 @@ namespace cortexm::architecture
   void
   wfi (void);
 
+  /**
+   * The assembler `wfe` instruction.
+   */
+  void
+  wfe (void);
+
+  /**
+   * The assembler `dmb` instruction.
+   */
+  void
+  dmb (void);
+
+  /**
+   * The assembler `dsb` instruction.
+   */
+  void
+  dsb (void);
+
+  /**
+   * The assembler `isb` instruction.
+   */
+  void
+  isb (void);
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  /**
+   * The assembler `ldrexb`/`ldrexh`/`ldrex` instructions.
+   */
+  uint8_t
+  ldrex (volatile uint8_t* address);
+
+  uint16_t
+  ldrex (volatile uint16_t* address);
+
+  uint32_t
+  ldrex (volatile uint32_t* address);
+
+  /**
+   * The assembler `strexb`/`strexh`/`strex` instructions;
+   * return 0 on success.
+   */
+  uint32_t
+  strex (uint8_t value, volatile uint8_t* address);
+
+  uint32_t
+  strex (uint16_t value, volatile uint16_t* address);
+
+  uint32_t
+  strex (uint32_t value, volatile uint32_t* address);
+
+  /**
+   * The assembler `clrex` instruction.
+   */
+  void
+  clrex (void);
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
   // --------------------------------------------------------------------------
 } // namespace cortexm::architecture
 
@@ -0,0 +1,391 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the Cortex-M interrupts masking.
+//
+// All have a "memory" clobber, to keep the compiler from moving the
+// memory accesses across them.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_disable (void)
+  {
+    __asm__ volatile(
+
+        " cpsid i "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_enable (void)
+  {
+    __asm__ volatile(
+
+        " cpsie i "
+
+        : /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_interrupts_get_primask (void)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " mrs %0, primask "
+
+        : "=r"(value) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_set_primask (uint32_t value)
+  {
+    __asm__ volatile(
+
+        " msr primask, %0 "
+
+        : /* Outputs */
+        : "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_interrupts_get_basepri (void)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " mrs %0, basepri "
+
+        : "=r"(value) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_set_basepri (uint32_t value)
+  {
+    __asm__ volatile(
+
+        " msr basepri, %0 "
+
+        : /* Outputs */
+        : "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_set_basepri_max (uint32_t value)
+  {
+    __asm__ volatile(
+
+        " msr basepri_max, %0 "
+
+        : /* Outputs */
+        : "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_interrupts_get_faultmask (void)
+  {
+    uint32_t value;
+
+    __asm__ volatile(
+
+        " mrs %0, faultmask "
+
+        : "=r"(value) /* Outputs */
+        : /* Inputs */
+        : "memory" /* Clobbers */
+    );
+
+    return value;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_set_faultmask (uint32_t value)
+  {
+    __asm__ volatile(
+
+        " msr faultmask, %0 "
+
+        : /* Outputs */
+        : "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_critical_section_enter (void)
+  {
+#if defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_basepri ();
+    cortexm_architecture_interrupts_set_basepri_max (
+        MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI);
+#else
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+#endif // defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+
+    return status;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_critical_section_exit (
+      cortexm_architecture_interrupts_status_t status)
+  {
+#if defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+    cortexm_architecture_interrupts_set_basepri (status);
+#else
+    cortexm_architecture_interrupts_set_primask (status);
+#endif // defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+  }
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_uncritical_section_enter (void)
+  {
+#if defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_basepri ();
+    cortexm_architecture_interrupts_set_basepri (0);
+#else
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_enable ();
+#endif // defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+
+    return status;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_uncritical_section_exit (
+      cortexm_architecture_interrupts_status_t status)
+  {
+#if defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+    cortexm_architecture_interrupts_set_basepri (status);
+#else
+    cortexm_architecture_interrupts_set_primask (status);
+#endif // defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_disable (void)
+  {
+    cortexm_architecture_interrupts_disable ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_enable (void)
+  {
+    cortexm_architecture_interrupts_enable ();
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_critical_section_enter (void)
+  {
+    return cortexm_architecture_interrupts_critical_section_enter ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_critical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_critical_section_exit (status);
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_uncritical_section_enter (void)
+  {
+    return cortexm_architecture_interrupts_uncritical_section_enter ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_uncritical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_uncritical_section_exit (status);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    cortexm_architecture_interrupts_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    cortexm_architecture_interrupts_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  primask (void)
+  {
+    return cortexm_architecture_interrupts_get_primask ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  primask (uint32_t value)
+  {
+    cortexm_architecture_interrupts_set_primask (value);
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  inline __attribute__ ((always_inline)) uint32_t
+  basepri (void)
+  {
+    return cortexm_architecture_interrupts_get_basepri ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  basepri (uint32_t value)
+  {
+    cortexm_architecture_interrupts_set_basepri (value);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  basepri_max (uint32_t value)
+  {
+    cortexm_architecture_interrupts_set_basepri_max (value);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  faultmask (void)
+  {
+    return cortexm_architecture_interrupts_get_faultmask ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  faultmask (uint32_t value)
+  {
+    cortexm_architecture_interrupts_set_faultmask (value);
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) critical_section::critical_section ()
+      : status_{ cortexm_architecture_interrupts_critical_section_enter () }
+  {
+  }
+
+  inline __attribute__ ((always_inline)) critical_section::~critical_section ()
+  {
+    cortexm_architecture_interrupts_critical_section_exit (status_);
+  }
+
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline))
+  uncritical_section::uncritical_section ()
+      : status_{ cortexm_architecture_interrupts_uncritical_section_enter () }
+  {
+  }
+
+  inline __attribute__ ((always_inline))
+  uncritical_section::~uncritical_section ()
+  {
+    cortexm_architecture_interrupts_uncritical_section_exit (status_);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::interrupts
+
+namespace micro_os_plus::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    cortexm::architecture::interrupts::disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    cortexm::architecture::interrupts::enable ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::interrupts
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_INLINES_H_
+
+// ----------------------------------------------------------------------------
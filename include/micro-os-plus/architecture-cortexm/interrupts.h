@@ -0,0 +1,346 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+// The critical sections mask with BASEPRI when the application defines
+// its raw value (for example 0x40) in
+// MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI, leaving the
+// interrupts with higher priorities (lower values) running; they must
+// not use the kernel services.
+// Otherwise, and on ARMv6-M/ARMv8-M Baseline, which have no BASEPRI,
+// they mask all interrupts with PRIMASK; since all interrupts have
+// priority 0 after reset, this is the safe default.
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE) \
+    && defined(MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI)
+#define CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI
+#endif
+
+// ----------------------------------------------------------------------------
+// Declarations of Cortex-M functions to mask the interrupts.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * The previous state, as returned by the `enter` functions,
+   * to be passed to the matching `exit` functions.
+   */
+  typedef uint32_t cortexm_architecture_interrupts_status_t;
+
+  // --------------------------------------------------------------------------
+  // Architecture interrupts masking in C.
+
+  /**
+   * `cpsid i` instruction; set PRIMASK, mask all configurable interrupts.
+   */
+  static void
+  cortexm_architecture_interrupts_disable (void);
+
+  /**
+   * `cpsie i` instruction; clear PRIMASK.
+   */
+  static void
+  cortexm_architecture_interrupts_enable (void);
+
+  /**
+   * Get the PRIMASK register (1 if interrupts are masked).
+   */
+  static uint32_t
+  cortexm_architecture_interrupts_get_primask (void);
+
+  /**
+   * Set the PRIMASK register.
+   */
+  static void
+  cortexm_architecture_interrupts_set_primask (uint32_t value);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  /**
+   * Get the BASEPRI register.
+   */
+  static uint32_t
+  cortexm_architecture_interrupts_get_basepri (void);
+
+  /**
+   * Set the BASEPRI register; 0 does not mask anything.
+   */
+  static void
+  cortexm_architecture_interrupts_set_basepri (uint32_t value);
+
+  /**
+   * Set the BASEPRI register via BASEPRI_MAX, only if it
+   * raises the masking level.
+   */
+  static void
+  cortexm_architecture_interrupts_set_basepri_max (uint32_t value);
+
+  /**
+   * Get the FAULTMASK register.
+   */
+  static uint32_t
+  cortexm_architecture_interrupts_get_faultmask (void);
+
+  /**
+   * Set the FAULTMASK register; 1 masks also HardFault.
+   */
+  static void
+  cortexm_architecture_interrupts_set_faultmask (uint32_t value);
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  /**
+   * Mask the interrupts that may use the kernel services, with BASEPRI
+   * or PRIMASK, and return the previous state.
+   */
+  static cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_critical_section_enter (void);
+
+  /**
+   * Restore the state before the matching `enter`.
+   */
+  static void
+  cortexm_architecture_interrupts_critical_section_exit (
+      cortexm_architecture_interrupts_status_t status);
+
+  /**
+   * Unmask all interrupts, and return the previous state.
+   */
+  static cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_uncritical_section_enter (void);
+
+  /**
+   * Restore the state before the matching `enter`.
+   */
+  static void
+  cortexm_architecture_interrupts_uncritical_section_exit (
+      cortexm_architecture_interrupts_status_t status);
+
+  // --------------------------------------------------------------------------
+  // Portable architecture interrupts masking in C.
+
+  typedef cortexm_architecture_interrupts_status_t
+      micro_os_plus_architecture_interrupts_status_t;
+
+  /**
+   * Mask all interrupts.
+   */
+  static void
+  micro_os_plus_architecture_interrupts_disable (void);
+
+  /**
+   * Unmask all interrupts.
+   */
+  static void
+  micro_os_plus_architecture_interrupts_enable (void);
+
+  /**
+   * Enter a critical section.
+   */
+  static micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_critical_section_enter (void);
+
+  /**
+   * Exit a critical section.
+   */
+  static void
+  micro_os_plus_architecture_interrupts_critical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status);
+
+  /**
+   * Enter an uncritical section.
+   */
+  static micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_uncritical_section_enter (void);
+
+  /**
+   * Exit an uncritical section.
+   */
+  static void
+  micro_os_plus_architecture_interrupts_uncritical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+  // Architecture interrupts masking in C++.
+
+  using status_t = cortexm_architecture_interrupts_status_t;
+
+  /**
+   * The `cpsid i` instruction.
+   */
+  void
+  disable (void);
+
+  /**
+   * The `cpsie i` instruction.
+   */
+  void
+  enable (void);
+
+  /**
+   * Get the PRIMASK register.
+   */
+  uint32_t
+  primask (void);
+
+  /**
+   * Set the PRIMASK register.
+   */
+  void
+  primask (uint32_t value);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  /**
+   * Get the BASEPRI register.
+   */
+  uint32_t
+  basepri (void);
+
+  /**
+   * Set the BASEPRI register.
+   */
+  void
+  basepri (uint32_t value);
+
+  /**
+   * Raise the BASEPRI level, via BASEPRI_MAX.
+   */
+  void
+  basepri_max (uint32_t value);
+
+  /**
+   * Get the FAULTMASK register.
+   */
+  uint32_t
+  faultmask (void);
+
+  /**
+   * Set the FAULTMASK register.
+   */
+  void
+  faultmask (uint32_t value);
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  /**
+   * RAII guard; masks the interrupts that may use the kernel services
+   * in the constructor and restores the previous state in the
+   * destructor. Can be nested.
+   */
+  class critical_section
+  {
+  public:
+    critical_section ();
+
+    ~critical_section ();
+
+    critical_section (const critical_section&) = delete;
+    critical_section (critical_section&&) = delete;
+    critical_section&
+    operator= (const critical_section&)
+        = delete;
+    critical_section&
+    operator= (critical_section&&)
+        = delete;
+
+  protected:
+    const status_t status_;
+  };
+
+  /**
+   * RAII guard; unmasks all interrupts in the constructor and
+   * restores the previous state in the destructor. To be used inside
+   * critical sections, around lengthy operations.
+   */
+  class uncritical_section
+  {
+  public:
+    uncritical_section ();
+
+    ~uncritical_section ();
+
+    uncritical_section (const uncritical_section&) = delete;
+    uncritical_section (uncritical_section&&) = delete;
+    uncritical_section&
+    operator= (const uncritical_section&)
+        = delete;
+    uncritical_section&
+    operator= (uncritical_section&&)
+        = delete;
+
+  protected:
+    const status_t status_;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::interrupts
+
+namespace micro_os_plus::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+  // Portable architecture interrupts masking in C++.
+
+  using status_t = cortexm::architecture::interrupts::status_t;
+
+  using critical_section = cortexm::architecture::interrupts::critical_section;
+  using uncritical_section
+      = cortexm::architecture::interrupts::uncritical_section;
+
+  /**
+   * Mask all interrupts.
+   */
+  void
+  disable (void);
+
+  /**
+   * Unmask all interrupts.
+   */
+  void
+  enable (void);
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::interrupts
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INTERRUPTS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_irq_statistics_enter (void)
+  {
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+    return cortexm_architecture_cycles_read ();
+#else
+    return 0;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_irq_statistics_exit (uint32_t begin)
+  {
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+    uint32_t end = cortexm_architecture_cycles_read ();
+    cortexm_architecture_irq_statistics_record (
+        cortexm_architecture_get_ipsr ()
+            & CORTEXM_ARCHITECTURE_IPSR_EXCEPTION_MASK,
+        begin, end);
+#else
+    (void)begin;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_irq_statistics_pend (int32_t irq)
+  {
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+    cortexm_architecture_irq_statistics_record_pend ((uint32_t)(irq + 16));
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+    if (irq >= 0)
+      {
+        cortexm_architecture_nvic_set_pending (irq);
+      }
+    else if (irq == -2)
+      {
+        CORTEXM_ARCHITECTURE_SCB_ICSR = CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSVSET;
+      }
+    else if (irq == -1)
+      {
+        CORTEXM_ARCHITECTURE_SCB_ICSR = CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET;
+      }
+#else
+    (void)irq;
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+  }
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  // Called from the handlers, at their priority; only the sample is
+  // stored, the statistics are updated later, outside the handlers.
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_irq_statistics_record (uint32_t exception,
+                                              uint32_t begin, uint32_t end)
+  {
+    if (exception >= CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT)
+      {
+        return;
+      }
+
+    uint32_t duration = end - begin;
+    uint32_t latency = CORTEXM_ARCHITECTURE_IRQ_STATISTICS_NO_LATENCY;
+
+    // An exception cannot preempt itself, so its pend time is not
+    // changed meanwhile.
+    uint32_t pend_time
+        = cortexm_architecture_irq_statistics_pend_times[exception];
+    if (pend_time != 0)
+      {
+        latency = begin - pend_time;
+        cortexm_architecture_irq_statistics_pend_times[exception] = 0;
+      }
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS) \
+    && !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+    else if (exception == 15)
+      {
+        // SysTick was pended when the counter wrapped; the timer has
+        // been counting down from the reload value since then, also
+        // during the handler. Otherwise, it was reloaded again, or it
+        // is not clocked by the core.
+        uint32_t since_reload
+            = CORTEXM_ARCHITECTURE_SYST_RVR - CORTEXM_ARCHITECTURE_SYST_CVR;
+        if (since_reload >= duration)
+          {
+            latency = since_reload - duration;
+          }
+      }
+#endif
+
+    // Reserve a slot; the nested handlers take the next ones.
+    cortexm_architecture_irq_statistics_runs_t* runs
+        = &cortexm_architecture_irq_statistics_runs;
+    uint32_t head = runs->head;
+    do
+      {
+        if (head - runs->tail
+            >= MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES)
+          {
+            cortexm_architecture_atomic_fetch_add (&runs->dropped, 1);
+            return;
+          }
+      }
+    while (!cortexm_architecture_atomic_compare_exchange (&runs->head, &head,
+                                                          head + 1));
+
+    cortexm_architecture_irq_statistics_sample_t* sample
+        = &runs->samples[head
+                         & (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES
+                            - 1)];
+    sample->exception = exception;
+    sample->duration = duration;
+    sample->latency = latency;
+  }
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  // log2, with the short durations in the first bucket and the long
+  // ones in the last.
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_irq_statistics_bucket (uint32_t duration)
+  {
+    uint32_t bucket = 31 - (uint32_t)__builtin_clz (duration | 1);
+    if (bucket > MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SHIFT)
+      {
+        bucket -= MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SHIFT;
+      }
+    else
+      {
+        bucket = 0;
+      }
+    if (bucket >= MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS)
+      {
+        bucket = MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS - 1;
+      }
+    return bucket;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::irq_statistics
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) scope::scope ()
+      : begin_{ cortexm_architecture_irq_statistics_enter () }
+  {
+  }
+
+  inline __attribute__ ((always_inline)) scope::~scope ()
+  {
+    cortexm_architecture_irq_statistics_exit (begin_);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  pend (int32_t irq)
+  {
+    cortexm_architecture_irq_statistics_pend (irq);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  bucket (uint32_t duration)
+  {
+    return cortexm_architecture_irq_statistics_bucket (duration);
+  }
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  inline __attribute__ ((always_inline)) void
+  fold (void)
+  {
+    cortexm_architecture_irq_statistics_fold ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  dropped (void)
+  {
+    return cortexm_architecture_irq_statistics_dropped ();
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  snapshot (int32_t irq, statistics_t& statistics)
+  {
+    return cortexm_architecture_irq_statistics_snapshot (irq, &statistics);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  reset (void)
+  {
+    cortexm_architecture_irq_statistics_reset ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  format (int32_t irq, const statistics_t& statistics, char* buffer,
+          size_t size)
+  {
+    return cortexm_architecture_irq_statistics_format (irq, &statistics,
+                                                       buffer, size);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dump (void)
+  {
+    cortexm_architecture_irq_statistics_dump ();
+  }
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  inline __attribute__ ((always_inline)) void
+  install (void)
+  {
+    cortexm_architecture_irq_statistics_install ();
+  }
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::irq_statistics
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_INLINES_H_
+
+// ----------------------------------------------------------------------------
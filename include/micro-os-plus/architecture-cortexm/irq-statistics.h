@@ -0,0 +1,394 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+#include <micro-os-plus/architecture-cortexm/nvic.h>
+#include <micro-os-plus/architecture-cortexm/vectors.h>
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Per exception duration and latency statistics, in cycles (see
+// `cycles.h`; the counter must be enabled, and not reset meanwhile).
+//
+// With MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS, the handlers are
+// measured between `cortexm_architecture_irq_statistics_enter()`
+// and `cortexm_architecture_irq_statistics_exit()`, called by the
+// handlers themselves or, with MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS,
+// by the dispatcher which `cortexm_architecture_irq_statistics_install()`
+// puts in front of SysTick and of the measured device interrupts.
+// Otherwise the hooks are empty and the compiler removes them.
+//
+// The entry hook only reads the counter; the exit hook, inline, only
+// stores the exception number, the duration and the latency in a
+// small buffer, reserving the slot atomically, without masking the
+// interrupts (except on ARMv6-M, for the reservation). The statistics
+// are updated from the buffer later, by
+// `cortexm_architecture_irq_statistics_fold()`, outside the handlers.
+// The durations include the time spent in the nested handlers.
+//
+// The entry latency is known for SysTick, clocked by the core, from
+// the time it was reloaded, and for the exceptions pended with
+// `cortexm_architecture_irq_statistics_pend()`.
+//
+// On the synthetic POSIX backend, the signal handlers are not
+// identified, so the hooks account all runs to the exception 0 (IRQ
+// -16), and `cortexm_architecture_irq_statistics_pend()` only
+// records the time.
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS)
+#define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS (16)
+#endif
+
+// The first histogram bucket counts the durations below
+// 2^(SHIFT + 1) cycles; each following bucket doubles the limit, and
+// the last one counts all the longer durations.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SHIFT)
+#define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SHIFT (4)
+#endif
+
+// The handler runs recorded and not yet folded into the statistics,
+// a power of 2; when the buffer is full, the runs are dropped.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES)
+#define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES (64)
+#endif
+
+// The device interrupts measured, from IRQ 0; each one takes about
+// 100 bytes of RAM, so the application must give the number the
+// device really has, not the architecture maximum.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS)
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+// No interrupt controller; as many entries as on ARMv6-M.
+#define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS (32)
+#elif defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+#error "Define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS"
+#else
+#define MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS (0)
+#endif
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS)
+
+// One entry per exception number; the IRQ n is the exception 16 + n.
+#define CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT \
+  (16 + MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS)
+
+// The latency of a run without a known pend time.
+#define CORTEXM_ARCHITECTURE_IRQ_STATISTICS_NO_LATENCY (UINT32_MAX)
+
+// The buffer size for any line written by
+// `cortexm_architecture_irq_statistics_format()`: the labels, 11
+// characters for the IRQ number and 10 for each count, the commas,
+// the new line and the terminator.
+#define CORTEXM_ARCHITECTURE_IRQ_STATISTICS_LINE_SIZE \
+  (178 + 11 * MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef struct cortexm_architecture_irq_statistics_s
+  {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+
+    // Only for the entries with a known pend time.
+    uint32_t latency_count;
+    uint32_t latency_max;
+    uint64_t latency_total;
+
+    uint32_t histogram[MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS];
+  } cortexm_architecture_irq_statistics_t;
+
+  // A handler run, recorded by the exit hook.
+  typedef struct cortexm_architecture_irq_statistics_sample_s
+  {
+    uint32_t exception;
+    uint32_t duration;
+    // CORTEXM_ARCHITECTURE_IRQ_STATISTICS_NO_LATENCY if not known.
+    uint32_t latency;
+  } cortexm_architecture_irq_statistics_sample_t;
+
+  // The runs recorded and not yet folded, with free running indices;
+  // the hooks reserve a slot by incrementing `head`, and write it
+  // before returning to the thread which folds it.
+  typedef struct cortexm_architecture_irq_statistics_runs_s
+  {
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    cortexm_architecture_irq_statistics_sample_t
+        samples[MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES];
+  } cortexm_architecture_irq_statistics_runs_t;
+
+  // --------------------------------------------------------------------------
+  // IRQ statistics in C.
+
+  /**
+   * The entry hook; returns the cycle count, to be passed to the exit
+   * hook.
+   */
+  static uint32_t
+  cortexm_architecture_irq_statistics_enter (void);
+
+  /**
+   * The exit hook, in the same handler.
+   */
+  static void
+  cortexm_architecture_irq_statistics_exit (uint32_t begin);
+
+  /**
+   * Set an interrupt, PendSV or SysTick pending, and remember the
+   * time, to measure the entry latency.
+   */
+  static void
+  cortexm_architecture_irq_statistics_pend (int32_t irq);
+
+  /**
+   * The histogram bucket of a duration.
+   */
+  static uint32_t
+  cortexm_architecture_irq_statistics_bucket (uint32_t duration);
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  /**
+   * Record a handler run, from `begin` to `end`, to be folded into
+   * the statistics later. Called by the exit hook and the dispatcher.
+   */
+  static void
+  cortexm_architecture_irq_statistics_record (uint32_t exception,
+                                              uint32_t begin, uint32_t end);
+
+  /**
+   * Remember the time an exception is pended. Called by
+   * `cortexm_architecture_irq_statistics_pend()`.
+   */
+  void
+  cortexm_architecture_irq_statistics_record_pend (uint32_t exception);
+
+  /**
+   * Update the statistics with the recorded runs, masking the
+   * interrupts for one run at a time. Done by `_snapshot()` and
+   * `_dump()`; if they are called rarely, to be called periodically,
+   * for example from the idle loop, not to drop runs. Not from the
+   * handlers, which may have preempted a hook between the slot
+   * reservation and the write.
+   */
+  void
+  cortexm_architecture_irq_statistics_fold (void);
+
+  /**
+   * The number of runs dropped since the last reset, when the buffer
+   * was full.
+   */
+  uint32_t
+  cortexm_architecture_irq_statistics_dropped (void);
+
+  /**
+   * Fold the recorded runs and copy the statistics of an interrupt or
+   * of a system exception, with the interrupts masked for the
+   * duration of the copy. Returns false if the IRQ is out of range.
+   */
+  bool
+  cortexm_architecture_irq_statistics_snapshot (
+      int32_t irq, cortexm_architecture_irq_statistics_t* statistics);
+
+  /**
+   * Clear all statistics.
+   */
+  void
+  cortexm_architecture_irq_statistics_reset (void);
+
+  /**
+   * Format the statistics as a single line, `MICRO_OS_PLUS_IRQ irq=<n>
+   * count=<n> min=<n> avg=<n> max=<n> latency_count=<n>
+   * latency_avg=<n> latency_max=<n> histogram=<n>,<n>,...`, truncated
+   * to the buffer size. Returns the length, without the terminator.
+   */
+  size_t
+  cortexm_architecture_irq_statistics_format (
+      int32_t irq, const cortexm_architecture_irq_statistics_t* statistics,
+      char* buffer, size_t size);
+
+  /**
+   * Write the statistics of all the exceptions which occurred via
+   * semihosting, one line each.
+   */
+  void
+  cortexm_architecture_irq_statistics_dump (void);
+
+  // The buffer written by the hooks.
+  extern cortexm_architecture_irq_statistics_runs_t
+      cortexm_architecture_irq_statistics_runs;
+
+  // The counter when each exception was pended; 0 if not known.
+  extern volatile uint32_t cortexm_architecture_irq_statistics_pend_times
+      [CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT];
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  /**
+   * Replace the SysTick and the first
+   * `MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS` device interrupt
+   * vectors in the RAM table with a dispatcher which calls the
+   * original handlers between the hooks;
+   * `cortexm_architecture_vectors_set_handler()` then changes the
+   * dispatched handlers. The other system exceptions are not wrapped,
+   * since their handlers may depend on the exception entry state.
+   */
+  void
+  cortexm_architecture_irq_statistics_install (void);
+
+  /**
+   * The dispatcher.
+   */
+  void
+  cortexm_architecture_irq_statistics_dispatch (void);
+
+  // The handlers called by the dispatcher.
+  extern cortexm_architecture_vectors_handler_t
+      cortexm_architecture_irq_statistics_handlers[];
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::irq_statistics
+{
+  // --------------------------------------------------------------------------
+  // IRQ statistics in C++.
+
+  using statistics_t = cortexm_architecture_irq_statistics_t;
+
+  /**
+   * Measure the handler from the constructor to the destructor.
+   *
+   * @code
+   * void
+   * UART0_IRQHandler (void)
+   * {
+   *   irq_statistics::scope measured;
+   *   ...
+   * }
+   * @endcode
+   */
+  class scope
+  {
+  public:
+    scope ();
+
+    ~scope ();
+
+    scope (const scope&) = delete;
+    scope&
+    operator= (const scope&)
+        = delete;
+
+  protected:
+    uint32_t begin_;
+  };
+
+  /**
+   * Set pending and remember the time.
+   */
+  void
+  pend (int32_t irq);
+
+  /**
+   * The histogram bucket of a duration.
+   */
+  uint32_t
+  bucket (uint32_t duration);
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  /**
+   * Update the statistics with the recorded runs.
+   */
+  void
+  fold (void);
+
+  /**
+   * The number of runs dropped when the buffer was full.
+   */
+  uint32_t
+  dropped (void);
+
+  /**
+   * Copy the statistics of an interrupt or of a system exception.
+   */
+  bool
+  snapshot (int32_t irq, statistics_t& statistics);
+
+  /**
+   * Clear all statistics.
+   */
+  void
+  reset (void);
+
+  /**
+   * Format the statistics as a single line.
+   */
+  size_t
+  format (int32_t irq, const statistics_t& statistics, char* buffer,
+          size_t size);
+
+  /**
+   * Write all statistics via semihosting.
+   */
+  void
+  dump (void);
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  /**
+   * Measure SysTick and the device interrupts.
+   */
+  void
+  install (void);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::irq_statistics
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_IRQ_STATISTICS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_mpu_disable (void)
+  {
+    // The previous accesses complete with the old attributes.
+    cortexm_architecture_dmb ();
+    CORTEXM_ARCHITECTURE_MPU_CTRL = 0;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::mpu
+{
+  // --------------------------------------------------------------------------
+
+  template <uint32_t Base, uint32_t Size, access Access, memory Memory,
+            bool Execute>
+  constexpr region_t
+  region (void)
+  {
+#if defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+    static_assert (Size >= 32 && (Size % 32) == 0,
+                   "The region size must be a multiple of 32 bytes");
+    static_assert ((Base % 32) == 0,
+                   "The region base must be aligned to 32 bytes");
+    static_assert (Base + (Size - 1) >= Base,
+                   "The region must not wrap around");
+#else
+    static_assert (Size >= 32 && (Size & (Size - 1)) == 0,
+                   "The region size must be a power of 2, at least 32");
+    static_assert ((Base & (Size - 1)) == 0,
+                   "The region base must be aligned to its size");
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+    return region_t{
+      CORTEXM_ARCHITECTURE_MPU_RBAR (Base, Size,
+                                     static_cast<uint32_t> (Access),
+                                     static_cast<uint32_t> (Memory), Execute),
+      CORTEXM_ARCHITECTURE_MPU_ATTRIBUTES (
+          Base, Size, static_cast<uint32_t> (Access),
+          static_cast<uint32_t> (Memory), Execute)
+    };
+  }
+
+  template <size_t N>
+  inline __attribute__ ((always_inline)) bool
+  load (const region_t (&regions)[N])
+  {
+    static_assert (N <= 16, "The MPU has at most 16 regions");
+    return cortexm_architecture_mpu_load (regions, N);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  configure_default (void)
+  {
+    return cortexm_architecture_mpu_configure_default ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    cortexm_architecture_mpu_disable ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::mpu
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,224 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Memory Protection Unit, on ARMv7-M (PMSAv7) and ARMv8-M Mainline
+// (PMSAv8).
+//
+// A region is a pair of words, RBAR and RASR (ARMv7-M) or RBAR and
+// RLAR (ARMv8-M), encoded by the macros below, or, in C++, at compile
+// time, by `mpu::region<>()`, which checks the size and the
+// alignment. A table is written by `cortexm_architecture_mpu_load()`,
+// four regions at a time via the alias registers, with the MPU
+// disabled; the unused regions are disabled.
+//
+// The ARMv7-M regions have a power of 2 size, aligned to it, and may
+// overlap (the higher region number wins); the ARMv8-M regions are
+// multiples of 32 bytes and must not overlap.
+//
+// The memory types are mapped to TEX/C/B (ARMv7-M) or to fixed MAIR
+// indices (ARMv8-M). The normal memory is not shareable: on the
+// Cortex-M7 the shareable regions are not cached.
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+#define CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8
+#endif
+
+// Access permissions.
+#define CORTEXM_ARCHITECTURE_MPU_ACCESS_PRIVILEGED_READ_WRITE (0UL)
+#define CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE (1UL)
+#define CORTEXM_ARCHITECTURE_MPU_ACCESS_PRIVILEGED_READ_ONLY (2UL)
+#define CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_ONLY (3UL)
+
+// Memory types; on ARMv8-M the MAIR attribute index.
+#define CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK (0UL)
+#define CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_THROUGH (1UL)
+#define CORTEXM_ARCHITECTURE_MPU_MEMORY_NON_CACHEABLE (2UL)
+#define CORTEXM_ARCHITECTURE_MPU_MEMORY_DEVICE (3UL)
+#define CORTEXM_ARCHITECTURE_MPU_MEMORY_STRONGLY_ORDERED (4UL)
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+// The attributes of the memory types, write-back read/write allocate
+// (0xFF), write-through read allocate (0xAA), non-cacheable (0x44),
+// Device-nGnRE (0x04) and Device-nGnRnE (0x00).
+#define CORTEXM_ARCHITECTURE_MPU_MAIR0_VALUE (0x0444AAFFUL)
+#define CORTEXM_ARCHITECTURE_MPU_MAIR1_VALUE (0x00000000UL)
+
+// RBAR: base, not shareable, AP[2:1], XN.
+#define CORTEXM_ARCHITECTURE_MPU_RBAR(base, size, access, memory, execute) \
+  (((base) & ~0x1FUL) | ((access) << 1) | ((execute) ? 0UL : 1UL))
+
+// RLAR: the last 32-byte block, the attribute index, enabled.
+#define CORTEXM_ARCHITECTURE_MPU_ATTRIBUTES(base, size, access, memory, \
+                                            execute)                    \
+  ((((base) + (size)-1) & ~0x1FUL) | ((memory) << 1) | 1UL)
+
+#else
+
+// TEX, C and B.
+#define CORTEXM_ARCHITECTURE_MPU_TEX_C_B(memory)                            \
+  ((memory) == CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK      ? 0xB0000UL \
+   : (memory) == CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_THROUGH ? 0x20000UL \
+   : (memory) == CORTEXM_ARCHITECTURE_MPU_MEMORY_NON_CACHEABLE ? 0x80000UL \
+   : (memory) == CORTEXM_ARCHITECTURE_MPU_MEMORY_DEVICE        ? 0x10000UL \
+                                                               : 0UL)
+
+// RBAR: the base; the loader adds VALID and the region number.
+#define CORTEXM_ARCHITECTURE_MPU_RBAR(base, size, access, memory, execute) \
+  ((base) & ~0x1FUL)
+
+// RASR: XN, AP (001, 011, 101, 110 for the access permissions above),
+// TEX/C/B, SIZE (log2(size) - 1), enabled.
+#define CORTEXM_ARCHITECTURE_MPU_ATTRIBUTES(base, size, access, memory, \
+                                            execute)                    \
+  (((execute) ? 0UL : (1UL << 28))                                      \
+   | (((0x6531UL >> ((access)*4)) & 0x7UL) << 24)                       \
+   | CORTEXM_ARCHITECTURE_MPU_TEX_C_B (memory)                          \
+   | (((uint32_t)__builtin_ctz (size) - 1) << 1) | 1UL)
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef struct cortexm_architecture_mpu_region_s
+  {
+    uint32_t rbar;
+    // RASR on ARMv7-M, RLAR on ARMv8-M.
+    uint32_t attributes;
+  } cortexm_architecture_mpu_region_t;
+
+  // --------------------------------------------------------------------------
+  // MPU in C.
+
+  /**
+   * Write the regions, disable the others, enable the MemManage fault
+   * and the MPU, with the default memory map as background for the
+   * privileged code. Returns false, without changes, if the device
+   * has fewer regions.
+   */
+  bool
+  cortexm_architecture_mpu_load (
+      const cortexm_architecture_mpu_region_t* regions, uint32_t count);
+
+  /**
+   * Load the default profile, derived from the linker script symbols:
+   * the code and the read only data, executable; the RAM, not
+   * executable; `.noncacheable`, not cached; on ARMv7-M, a read only
+   * guard band at the bottom of the main stack (on ARMv8-M MSPLIM
+   * catches the overflows). On ARMv7-M the regions are
+   * rounded to powers of 2, which fits the applications running from
+   * flash; when the RAM region covers code (`sections-ram.ld`, or
+   * `.fast_text` in RAM), it is left executable.
+   */
+  bool
+  cortexm_architecture_mpu_configure_default (void);
+
+  /**
+   * Disable the MPU.
+   */
+  static void
+  cortexm_architecture_mpu_disable (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::mpu
+{
+  // --------------------------------------------------------------------------
+  // MPU in C++.
+
+  using region_t = cortexm_architecture_mpu_region_t;
+
+  enum class access : uint32_t
+  {
+    privileged_read_write
+    = CORTEXM_ARCHITECTURE_MPU_ACCESS_PRIVILEGED_READ_WRITE,
+    read_write = CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+    privileged_read_only = CORTEXM_ARCHITECTURE_MPU_ACCESS_PRIVILEGED_READ_ONLY,
+    read_only = CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_ONLY,
+  };
+
+  enum class memory : uint32_t
+  {
+    write_back = CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK,
+    write_through = CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_THROUGH,
+    non_cacheable = CORTEXM_ARCHITECTURE_MPU_MEMORY_NON_CACHEABLE,
+    device = CORTEXM_ARCHITECTURE_MPU_MEMORY_DEVICE,
+    strongly_ordered = CORTEXM_ARCHITECTURE_MPU_MEMORY_STRONGLY_ORDERED,
+  };
+
+  /**
+   * Encode a region at compile time; the size and the alignment are
+   * checked with static_assert.
+   */
+  template <uint32_t Base, uint32_t Size, access Access, memory Memory,
+            bool Execute = false>
+  constexpr region_t
+  region (void);
+
+  /**
+   * Write a table of regions.
+   */
+  template <size_t N>
+  bool
+  load (const region_t (&regions)[N]);
+
+  /**
+   * Load the default profile.
+   */
+  bool
+  configure_default (void);
+
+  /**
+   * Disable the MPU.
+   */
+  void
+  disable (void);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::mpu
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_MPU_H_
+
+// ----------------------------------------------------------------------------
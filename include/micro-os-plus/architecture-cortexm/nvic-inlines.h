@@ -0,0 +1,533 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/interrupts.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_enable (int32_t irq)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ISER ((uint32_t)irq >> 5)
+        = 1UL << ((uint32_t)irq & 0x1FUL);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_disable (int32_t irq)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ICER ((uint32_t)irq >> 5)
+        = 1UL << ((uint32_t)irq & 0x1FUL);
+    // An interrupt already taken by the NVIC may still be triggered
+    // until the write completes.
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_set_pending (int32_t irq)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ISPR ((uint32_t)irq >> 5)
+        = 1UL << ((uint32_t)irq & 0x1FUL);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_clear_pending (int32_t irq)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ICPR ((uint32_t)irq >> 5)
+        = 1UL << ((uint32_t)irq & 0x1FUL);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_enable_mask (uint32_t word, uint32_t mask)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ISER (word) = mask;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_disable_mask (uint32_t word, uint32_t mask)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ICER (word) = mask;
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_set_pending_mask (uint32_t word, uint32_t mask)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ISPR (word) = mask;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_clear_pending_mask (uint32_t word, uint32_t mask)
+  {
+    CORTEXM_ARCHITECTURE_NVIC_ICPR (word) = mask;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_set_priority (int32_t irq, uint32_t priority)
+  {
+    // The priority bytes, from MemManage (exception 4) in SHPR1 to
+    // the last interrupt in IPR, with word accesses, as on ARMv6-M.
+    uint32_t index = (uint32_t)irq + 12;
+    volatile uint32_t* reg;
+    if (irq >= 0)
+      {
+        reg = &CORTEXM_ARCHITECTURE_NVIC_IPR (index / 4 - 3);
+      }
+    else
+      {
+        reg = &CORTEXM_ARCHITECTURE_SCB_SHPR (index / 4);
+      }
+    uint32_t shift = (index % 4) * 8;
+
+    *reg = (*reg & ~(0xFFUL << shift)) | ((priority & 0xFFUL) << shift);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_nvic_get_priority (int32_t irq)
+  {
+    uint32_t index = (uint32_t)irq + 12;
+    uint32_t word = (irq >= 0) ? CORTEXM_ARCHITECTURE_NVIC_IPR (index / 4 - 3)
+                               : CORTEXM_ARCHITECTURE_SCB_SHPR (index / 4);
+
+    return (word >> ((index % 4) * 8)) & 0xFFUL;
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nvic_set_priority_grouping (void)
+  {
+    // The subpriority takes the low implemented bits, the
+    // preemption priority the bits above PRIGROUP.
+    uint32_t prigroup = 8 - MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS
+                        + MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS
+                        - 1;
+    uint32_t aircr
+        = CORTEXM_ARCHITECTURE_SCB_AIRCR
+          & ~(0xFFFF0000UL | CORTEXM_ARCHITECTURE_SCB_AIRCR_PRIGROUP_MASK);
+
+    CORTEXM_ARCHITECTURE_SCB_AIRCR
+        = CORTEXM_ARCHITECTURE_SCB_AIRCR_VECTKEY | aircr
+          | (prigroup << CORTEXM_ARCHITECTURE_SCB_AIRCR_PRIGROUP_SHIFT);
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::nvic
+{
+  // --------------------------------------------------------------------------
+
+  constexpr uint32_t
+  encode_priority (uint32_t preemption, uint32_t subpriority)
+  {
+    return CORTEXM_ARCHITECTURE_NVIC_PRIORITY (preemption, subpriority);
+  }
+
+  constexpr uint32_t
+  basepri_threshold (uint32_t preemption)
+  {
+    return CORTEXM_ARCHITECTURE_NVIC_BASEPRI (preemption);
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+  // BASEPRI compares only the preemption priority.
+  static_assert (
+      (MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI
+       & (basepri_threshold (1) - 1))
+          == 0,
+      "MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI is not a "
+      "preemption priority threshold");
+#endif // defined(CORTEXM_ARCHITECTURE_INTERRUPTS_USE_BASEPRI)
+
+  inline __attribute__ ((always_inline)) void
+  enable (int32_t irq)
+  {
+    cortexm_architecture_nvic_enable (irq);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  disable (int32_t irq)
+  {
+    cortexm_architecture_nvic_disable (irq);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  set_pending (int32_t irq)
+  {
+    cortexm_architecture_nvic_set_pending (irq);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  clear_pending (int32_t irq)
+  {
+    cortexm_architecture_nvic_clear_pending (irq);
+  }
+
+  template <int32_t... Irqs>
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    static_assert (((Irqs >= 0 && Irqs < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+                    && ...),
+                   "Only the device interrupts can be enabled");
+    write_masks<irq_list<Irqs...>> (&CORTEXM_ARCHITECTURE_NVIC_ISER (0));
+  }
+
+  template <int32_t... Irqs>
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    static_assert (((Irqs >= 0 && Irqs < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+                    && ...),
+                   "Only the device interrupts can be disabled");
+    write_masks<irq_list<Irqs...>> (&CORTEXM_ARCHITECTURE_NVIC_ICER (0));
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  template <int32_t... Irqs>
+  inline __attribute__ ((always_inline)) void
+  set_pending (void)
+  {
+    static_assert (((Irqs >= 0 && Irqs < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+                    && ...),
+                   "Only the device interrupts can be set pending");
+    write_masks<irq_list<Irqs...>> (&CORTEXM_ARCHITECTURE_NVIC_ISPR (0));
+  }
+
+  inline __attribute__ ((always_inline)) void
+  set_priority (int32_t irq, uint32_t priority)
+  {
+    cortexm_architecture_nvic_set_priority (irq, priority);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  priority (int32_t irq)
+  {
+    return cortexm_architecture_nvic_get_priority (irq);
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  inline __attribute__ ((always_inline)) void
+  set_priority_grouping (void)
+  {
+    cortexm_architecture_nvic_set_priority_grouping ();
+  }
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // --------------------------------------------------------------------------
+
+  constexpr bool
+  is_configurable (int32_t irq)
+  {
+    if (irq >= 0)
+      {
+        return irq < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS;
+      }
+
+    switch (irq)
+      {
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+      case -12: // MemManage
+      case -11: // BusFault
+      case -10: // UsageFault
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+      case -9: // SecureFault
+#endif
+      case -4: // DebugMonitor
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+      case -5: // SVCall
+      case -2: // PendSV
+      case -1: // SysTick
+        return true;
+
+      default:
+        return false;
+      }
+  }
+
+  template <int32_t... Irqs>
+  constexpr uint32_t
+  irq_list<Irqs...>::words (void)
+  {
+    uint32_t result = 0;
+    ((result = ((uint32_t)Irqs / 32 >= result) ? (uint32_t)Irqs / 32 + 1
+                                                : result),
+     ...);
+    return result;
+  }
+
+  template <int32_t... Irqs>
+  constexpr uint32_t
+  irq_list<Irqs...>::mask (uint32_t word)
+  {
+    return (((uint32_t)Irqs / 32 == word ? 1UL << ((uint32_t)Irqs % 32) : 0UL)
+            | ... | 0UL);
+  }
+
+  template <typename List, uint32_t Word>
+  inline __attribute__ ((always_inline)) void
+  write_masks (volatile uint32_t* registers)
+  {
+    if constexpr (Word < List::words ())
+      {
+        constexpr uint32_t mask = List::mask (Word);
+        if constexpr (mask != 0)
+          {
+            registers[Word] = mask;
+          }
+        write_masks<List, Word + 1> (registers);
+      }
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <const auto& Entries>
+  inline __attribute__ ((always_inline)) void
+  priority_table<Entries>::write (void)
+  {
+    static_assert (valid_irqs_ (),
+                   "The IRQ is not a device interrupt or a system "
+                   "exception with a configurable priority");
+    static_assert (valid_priorities_ (),
+                   "The preemption priority or the subpriority does not "
+                   "fit the priority bits");
+    static_assert (unique_irqs_ (), "The IRQs must be unique");
+
+    write_priorities_<0> ();
+  }
+
+  template <const auto& Entries>
+  inline __attribute__ ((always_inline)) void
+  priority_table<Entries>::enable (void)
+  {
+    static_assert (valid_irqs_ (),
+                   "The IRQ is not a device interrupt or a system "
+                   "exception with a configurable priority");
+
+    write_masks<irqs_> (&CORTEXM_ARCHITECTURE_NVIC_ISER (0));
+  }
+
+  template <const auto& Entries>
+  inline __attribute__ ((always_inline)) void
+  priority_table<Entries>::disable (void)
+  {
+    static_assert (valid_irqs_ (),
+                   "The IRQ is not a device interrupt or a system "
+                   "exception with a configurable priority");
+
+    write_masks<irqs_> (&CORTEXM_ARCHITECTURE_NVIC_ICER (0));
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+  }
+
+  template <const auto& Entries>
+  constexpr bool
+  priority_table<Entries>::valid_priorities_ (void)
+  {
+    for (const entry& e : Entries)
+      {
+        if (e.preemption
+                >= (1UL << (MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS
+                            - MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS))
+            || e.subpriority
+                   >= (1UL << MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS))
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  template <const auto& Entries>
+  constexpr bool
+  priority_table<Entries>::valid_irqs_ (void)
+  {
+    for (const entry& e : Entries)
+      {
+        if (!is_configurable (e.irq))
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  template <const auto& Entries>
+  constexpr bool
+  priority_table<Entries>::unique_irqs_ (void)
+  {
+    for (std::size_t i = 0; i < count_; ++i)
+      {
+        for (std::size_t j = i + 1; j < count_; ++j)
+          {
+            if (Entries[i].irq == Entries[j].irq)
+              {
+                return false;
+              }
+          }
+      }
+    return true;
+  }
+
+  // The priority bytes are indexed from MemManage (exception 4) in
+  // SHPR1, as in cortexm_architecture_nvic_set_priority().
+
+  template <const auto& Entries>
+  constexpr uint32_t
+  priority_table<Entries>::priority_words_ (void)
+  {
+    uint32_t result = 0;
+    for (const entry& e : Entries)
+      {
+        uint32_t index = (uint32_t)e.irq + 12;
+        if (is_configurable (e.irq) && index / 4 >= result)
+          {
+            result = index / 4 + 1;
+          }
+      }
+    return result;
+  }
+
+  template <const auto& Entries>
+  constexpr uint32_t
+  priority_table<Entries>::priority_value_ (uint32_t word)
+  {
+    uint32_t result = 0;
+    for (const entry& e : Entries)
+      {
+        uint32_t index = (uint32_t)e.irq + 12;
+        if (is_configurable (e.irq) && index / 4 == word)
+          {
+            result |= (encode_priority (e.preemption, e.subpriority) & 0xFFUL)
+                      << ((index % 4) * 8);
+          }
+      }
+    return result;
+  }
+
+  template <const auto& Entries>
+  constexpr uint32_t
+  priority_table<Entries>::priority_mask_ (uint32_t word)
+  {
+    uint32_t result = 0;
+    for (const entry& e : Entries)
+      {
+        uint32_t index = (uint32_t)e.irq + 12;
+        if (is_configurable (e.irq) && index / 4 == word)
+          {
+            result |= 0xFFUL << ((index % 4) * 8);
+          }
+      }
+    return result;
+  }
+
+  template <const auto& Entries>
+  template <uint32_t Word>
+  inline __attribute__ ((always_inline)) void
+  priority_table<Entries>::write_priorities_ (void)
+  {
+    if constexpr (Word < priority_words_ ())
+      {
+        constexpr uint32_t mask = priority_mask_ (Word);
+        constexpr uint32_t value = priority_value_ (Word);
+        volatile uint32_t* reg;
+        if constexpr (Word < 3)
+          {
+            reg = &CORTEXM_ARCHITECTURE_SCB_SHPR (Word);
+          }
+        else
+          {
+            reg = &CORTEXM_ARCHITECTURE_NVIC_IPR (Word - 3);
+          }
+
+        if constexpr (mask == 0xFFFFFFFFUL)
+          {
+            *reg = value;
+          }
+        else if constexpr (mask != 0)
+          {
+            *reg = (*reg & ~mask) | value;
+          }
+        write_priorities_<Word + 1> ();
+      }
+  }
+
+  template <const auto& Entries>
+  constexpr uint32_t
+  priority_table<Entries>::irqs_::words (void)
+  {
+    uint32_t result = 0;
+    for (const entry& e : Entries)
+      {
+        if (is_configurable (e.irq) && e.irq >= 0
+            && (uint32_t)e.irq / 32 >= result)
+          {
+            result = (uint32_t)e.irq / 32 + 1;
+          }
+      }
+    return result;
+  }
+
+  template <const auto& Entries>
+  constexpr uint32_t
+  priority_table<Entries>::irqs_::mask (uint32_t word)
+  {
+    uint32_t result = 0;
+    for (const entry& e : Entries)
+      {
+        if (is_configurable (e.irq) && e.irq >= 0
+            && (uint32_t)e.irq / 32 == word)
+          {
+            result |= 1UL << ((uint32_t)e.irq % 32);
+          }
+      }
+    return result;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::nvic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,363 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+
+#include <cstddef>
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Interrupt controller (NVIC) and system exception priorities.
+//
+// The priorities are given as (preemption, subpriority) pairs and
+// encoded in the implemented bits, the most significant ones; with
+// MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS of them for the
+// subpriority, as set by `cortexm_architecture_nvic_set_priority_grouping()`.
+// The same encoding gives the BASEPRI thresholds, which compare only
+// the preemption part (see
+// MICRO_OS_PLUS_ARCHITECTURE_INTERRUPTS_CRITICAL_BASEPRI).
+//
+// The IRQ numbers are those of CMSIS; the system exceptions have
+// negative numbers (-1 SysTick, -2 PendSV, -5 SVCall, -12 MemManage).
+
+// The number of implemented priority bits; the architecture guarantees
+// at least 3 on ARMv7-M/ARMv8-M Mainline and 2 on Baseline, which are
+// safe defaults (a smaller value only leaves the low bits unused).
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS)
+#if defined(__NVIC_PRIO_BITS)
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS (__NVIC_PRIO_BITS)
+#elif defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS (3)
+#else
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS (2)
+#endif
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS)
+
+// The number of priority bits used for the subpriority; 0 (all bits
+// for preemption) on ARMv6-M and ARMv8-M Baseline.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS)
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS (0)
+#endif
+
+#if MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS \
+    > MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS
+#error "The subpriority bits exceed the priority bits"
+#endif
+
+#if !defined(CORTEXM_ARCHITECTURE_IS_MAINLINE) \
+    && MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS != 0
+#error "There is no priority grouping on ARMv6-M and ARMv8-M Baseline"
+#endif
+
+// AIRCR.PRIGROUP leaves at least one subpriority bit.
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)                    \
+    && MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS             \
+               - MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS \
+           > 7
+#error "There are at most 7 preemption priority bits"
+#endif
+
+// The number of device interrupts, for the checks.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS (240)
+#else
+#define MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS (32)
+#endif
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+
+// The register value for a (preemption, subpriority) pair.
+#define CORTEXM_ARCHITECTURE_NVIC_PRIORITY(preemption, subpriority)       \
+  (((((uint32_t)(preemption))                                              \
+     << MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS)                  \
+    | (uint32_t)(subpriority))                                             \
+   << (8 - MICRO_OS_PLUS_ARCHITECTURE_NVIC_PRIORITY_BITS))
+
+// The BASEPRI value which masks the interrupts with this preemption
+// priority and the lower ones (higher values).
+#define CORTEXM_ARCHITECTURE_NVIC_BASEPRI(preemption) \
+  CORTEXM_ARCHITECTURE_NVIC_PRIORITY (preemption, 0)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // NVIC in C.
+
+  /**
+   * Enable the interrupt.
+   */
+  static void
+  cortexm_architecture_nvic_enable (int32_t irq);
+
+  /**
+   * Disable the interrupt; when it returns, the interrupt is no longer
+   * taken.
+   */
+  static void
+  cortexm_architecture_nvic_disable (int32_t irq);
+
+  /**
+   * Set the interrupt pending.
+   */
+  static void
+  cortexm_architecture_nvic_set_pending (int32_t irq);
+
+  /**
+   * Clear the pending interrupt.
+   */
+  static void
+  cortexm_architecture_nvic_clear_pending (int32_t irq);
+
+  /**
+   * Enable the interrupts `32 * word + bit`, for the bits set in mask,
+   * with a single write; same for the functions below.
+   */
+  static void
+  cortexm_architecture_nvic_enable_mask (uint32_t word, uint32_t mask);
+
+  static void
+  cortexm_architecture_nvic_disable_mask (uint32_t word, uint32_t mask);
+
+  static void
+  cortexm_architecture_nvic_set_pending_mask (uint32_t word, uint32_t mask);
+
+  static void
+  cortexm_architecture_nvic_clear_pending_mask (uint32_t word, uint32_t mask);
+
+  /**
+   * Set the priority of an interrupt or of a system exception, as
+   * encoded by CORTEXM_ARCHITECTURE_NVIC_PRIORITY(); with a word
+   * read-modify-write.
+   */
+  static void
+  cortexm_architecture_nvic_set_priority (int32_t irq, uint32_t priority);
+
+  /**
+   * Get the encoded priority of an interrupt or of a system exception.
+   */
+  static uint32_t
+  cortexm_architecture_nvic_get_priority (int32_t irq);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  /**
+   * Set AIRCR.PRIGROUP to match
+   * MICRO_OS_PLUS_ARCHITECTURE_NVIC_SUBPRIORITY_BITS.
+   */
+  static void
+  cortexm_architecture_nvic_set_priority_grouping (void);
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::nvic
+{
+  // --------------------------------------------------------------------------
+  // NVIC in C++.
+
+  /**
+   * A priority table entry.
+   */
+  struct entry
+  {
+    int32_t irq;
+    uint32_t preemption;
+    uint32_t subpriority = 0;
+  };
+
+  /**
+   * The register value for a (preemption, subpriority) pair.
+   */
+  constexpr uint32_t
+  encode_priority (uint32_t preemption, uint32_t subpriority = 0);
+
+  /**
+   * The BASEPRI value which masks this preemption priority and the
+   * lower ones.
+   */
+  constexpr uint32_t
+  basepri_threshold (uint32_t preemption);
+
+  void
+  enable (int32_t irq);
+
+  void
+  disable (int32_t irq);
+
+  void
+  set_pending (int32_t irq);
+
+  void
+  clear_pending (int32_t irq);
+
+  /**
+   * Enable several interrupts, with one write per register.
+   */
+  template <int32_t... Irqs>
+  void
+  enable (void);
+
+  template <int32_t... Irqs>
+  void
+  disable (void);
+
+  template <int32_t... Irqs>
+  void
+  set_pending (void);
+
+  void
+  set_priority (int32_t irq, uint32_t priority);
+
+  uint32_t
+  priority (int32_t irq);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  void
+  set_priority_grouping (void);
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * True for the device interrupts and for the system exceptions with
+   * a configurable priority.
+   */
+  constexpr bool
+  is_configurable (int32_t irq);
+
+  /**
+   * A set of device interrupts, as register words and masks.
+   */
+  template <int32_t... Irqs>
+  struct irq_list
+  {
+    static constexpr uint32_t
+    words (void);
+
+    static constexpr uint32_t
+    mask (uint32_t word);
+  };
+
+  /**
+   * Write the non-zero masks of the list to consecutive registers
+   * (ISER, ICER, ISPR, ICPR); unrolled at compile time.
+   */
+  template <typename List, uint32_t Word = 0>
+  void
+  write_masks (volatile uint32_t* registers);
+
+  /**
+   * A constant table of priorities, checked at compile time against
+   * the priority bits, the grouping and the number of interrupts,
+   * and written with one access per register word: a store when all
+   * four bytes are in the table, a read-modify-write otherwise.
+   *
+   * @code
+   * static constexpr nvic::entry priorities[] = {
+   *   { UART0_IRQn, 2 }, { DMA0_IRQn, 1 }, { -1, 3 } // SysTick
+   * };
+   * nvic::priority_table<priorities>::write ();
+   * nvic::priority_table<priorities>::enable ();
+   * @endcode
+   */
+  template <const auto& Entries>
+  class priority_table
+  {
+  public:
+    /**
+     * Write the priorities of all entries; not atomic with respect
+     * to other writers of the same registers.
+     */
+    static void
+    write (void);
+
+    /**
+     * Enable all the device interrupts in the table.
+     */
+    static void
+    enable (void);
+
+    /**
+     * Disable all the device interrupts in the table.
+     */
+    static void
+    disable (void);
+
+  protected:
+    static constexpr std::size_t count_
+        = sizeof (Entries) / sizeof (Entries[0]);
+
+    static constexpr bool
+    valid_priorities_ (void);
+
+    static constexpr bool
+    valid_irqs_ (void);
+
+    static constexpr bool
+    unique_irqs_ (void);
+
+    // SHPR1-3, then the IPR words up to the highest device interrupt.
+    static constexpr uint32_t
+    priority_words_ (void);
+
+    static constexpr uint32_t
+    priority_value_ (uint32_t word);
+
+    static constexpr uint32_t
+    priority_mask_ (uint32_t word);
+
+    template <uint32_t Word>
+    static void
+    write_priorities_ (void);
+
+    // The device interrupts, for write_masks().
+    struct irqs_
+    {
+      static constexpr uint32_t
+      words (void);
+
+      static constexpr uint32_t
+      mask (uint32_t word);
+    };
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::nvic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_NVIC_H_
+
+// ----------------------------------------------------------------------------
@@ -18,7 +18,7 @@
 #include <stdint.h>
 
 // ----------------------------------------------------------------------------
-// Inline implementations for the Cortex-M architecture instructions.
+// Inline implementations for the Cortex-M core registers.
 
 #if defined(__cplusplus)
 extern "C"
@@ -30,11 +30,11 @@ extern "C"
   static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
   cortexm_architecture_get_msp (void)
   {
-    uint32_t result;
+    cortexm_architecture_register_t result;
 
     __asm__ volatile(
 
-        "msr %0, msp"
+        " mrs %0, msp "
 
         : "=r"(result) /* Outputs */
         : /* Inputs */
@@ -48,26 +48,212 @@ extern "C"
   cortexm_architecture_set_msp (
       cortexm_architecture_register_t top_of_main_stack)
   {
-    __asm__ volatile("msr msp, %0"
+    __asm__ volatile(
+
+        " msr msp, %0 "
+
+        : /* Outputs */
+        : "r"(top_of_main_stack) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_psp (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, psp "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_psp (
+      cortexm_architecture_register_t top_of_process_stack)
+  {
+    __asm__ volatile(
+
+        " msr psp, %0 "
+
+        : /* Outputs */
+        : "r"(top_of_process_stack) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_control (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, control "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_control (cortexm_architecture_register_t value)
+  {
+    __asm__ volatile(
+
+        " msr control, %0 \n"
+        " isb "
+
+        : /* Outputs */
+        : "r"(value) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_ipsr (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, ipsr "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_xpsr (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, xpsr "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_msplim (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, msplim "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_msplim (cortexm_architecture_register_t limit)
+  {
+    __asm__ volatile(
+
+        " msr msplim, %0 "
+
+        : /* Outputs */
+        : "r"(limit) /* Inputs */
+        : "memory" /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_psplim (void)
+  {
+    cortexm_architecture_register_t result;
+
+    __asm__ volatile(
+
+        " mrs %0, psplim "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
+  }
 
-                     : /* Outputs */
-                     : "r"(top_of_main_stack) /* Inputs */
-                     : /* Clobbers */
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_psplim (cortexm_architecture_register_t limit)
+  {
+    __asm__ volatile(
+
+        " msr psplim, %0 "
+
+        : /* Outputs */
+        : "r"(limit) /* Inputs */
+        : "memory" /* Clobbers */
     );
   }
 
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
+  // --------------------------------------------------------------------------
+
   static inline __attribute__ ((always_inline))
   micro_os_plus_architecture_register_t
   micro_os_plus_architecture_get_sp (void)
   {
-    return cortexm_architecture_get_msp ();
+    micro_os_plus_architecture_register_t result;
+
+    // The banked SP, MSP in handler mode or when CONTROL.SPSEL is 0,
+    // PSP otherwise.
+    __asm__ volatile(
+
+        " mov %0, sp "
+
+        : "=r"(result) /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+
+    return result;
   }
 
   static inline __attribute__ ((always_inline)) void
   micro_os_plus_architecture_set_sp (
       micro_os_plus_architecture_register_t top_of_stack)
   {
-    cortexm_architecture_set_msp (top_of_stack);
+    if (cortexm_architecture_get_ipsr () == 0
+        && (cortexm_architecture_get_control ()
+            & CORTEXM_ARCHITECTURE_CONTROL_SPSEL))
+      {
+        cortexm_architecture_set_psp (top_of_stack);
+      }
+    else
+      {
+        cortexm_architecture_set_msp (top_of_stack);
+      }
   }
 
   // --------------------------------------------------------------------------
@@ -96,6 +282,70 @@ namespace cortexm::architecture::registers
     cortexm_architecture_set_msp (top_of_main_stack);
   }
 
+  inline __attribute__ ((always_inline)) register_t
+  psp (void)
+  {
+    return cortexm_architecture_get_psp ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  psp (register_t top_of_process_stack)
+  {
+    cortexm_architecture_set_psp (top_of_process_stack);
+  }
+
+  inline __attribute__ ((always_inline)) register_t
+  control (void)
+  {
+    return cortexm_architecture_get_control ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  control (register_t value)
+  {
+    cortexm_architecture_set_control (value);
+  }
+
+  inline __attribute__ ((always_inline)) register_t
+  ipsr (void)
+  {
+    return cortexm_architecture_get_ipsr ();
+  }
+
+  inline __attribute__ ((always_inline)) register_t
+  xpsr (void)
+  {
+    return cortexm_architecture_get_xpsr ();
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
+  inline __attribute__ ((always_inline)) register_t
+  msplim (void)
+  {
+    return cortexm_architecture_get_msplim ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  msplim (register_t limit)
+  {
+    cortexm_architecture_set_msplim (limit);
+  }
+
+  inline __attribute__ ((always_inline)) register_t
+  psplim (void)
+  {
+    return cortexm_architecture_get_psplim ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  psplim (register_t limit)
+  {
+    cortexm_architecture_set_psplim (limit);
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
   // --------------------------------------------------------------------------
 } // namespace cortexm::architecture::registers
 
@@ -106,13 +356,13 @@ namespace micro_os_plus::architecture::registers
   inline __attribute__ ((always_inline)) register_t
   sp (void)
   {
-    return cortexm::architecture::registers::msp ();
+    return micro_os_plus_architecture_get_sp ();
   }
 
   inline __attribute__ ((always_inline)) void
-  msp (register_t top_of_main_stack)
+  sp (register_t top_of_stack)
   {
-    cortexm::architecture::registers::msp (top_of_main_stack);
+    micro_os_plus_architecture_set_sp (top_of_stack);
   }
 
   // --------------------------------------------------------------------------
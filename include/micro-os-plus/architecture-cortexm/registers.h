@@ -10,17 +10,29 @@
  * be obtained from https://opensource.org/licenses/MIT/.
  */
 
-#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INSTRUCTIONS_H_
-#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INSTRUCTIONS_H_
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_REGISTERS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_REGISTERS_H_
 
 // ----------------------------------------------------------------------------
 
 #include <micro-os-plus/architecture-cortexm/defines.h>
+#include <micro-os-plus/architecture-cortexm/types.h>
 
 #include <stdint.h>
 
 // ----------------------------------------------------------------------------
-// Declarations of Cortex-M functions to wrap architecture instructions.
+
+// CONTROL register bits.
+#define CORTEXM_ARCHITECTURE_CONTROL_NPRIV (1UL << 0) // Unprivileged thread.
+#define CORTEXM_ARCHITECTURE_CONTROL_SPSEL (1UL << 1) // Thread on PSP.
+#define CORTEXM_ARCHITECTURE_CONTROL_FPCA (1UL << 2) // FP context active.
+
+// The exception number, in IPSR and in the low bits of xPSR;
+// 0 in thread mode.
+#define CORTEXM_ARCHITECTURE_IPSR_EXCEPTION_MASK (0x1FFUL)
+
+// ----------------------------------------------------------------------------
+// Declarations of Cortex-M functions to access the core registers.
 
 #if defined(__cplusplus)
 extern "C"
@@ -43,15 +55,86 @@ extern "C"
   cortexm_architecture_set_msp (
       cortexm_architecture_register_t top_of_main_stack);
 
+  /**
+   * Process Stack Pointer getter.
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_psp (void);
+
+  /**
+   * Process Stack Pointer setter.
+   */
+  static void
+  cortexm_architecture_set_psp (
+      cortexm_architecture_register_t top_of_process_stack);
+
+  /**
+   * CONTROL register getter.
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_control (void);
+
+  /**
+   * CONTROL register setter, followed by `isb`, so that the next
+   * instructions use the new stack and privilege level.
+   */
+  static void
+  cortexm_architecture_set_control (cortexm_architecture_register_t value);
+
+  /**
+   * Interrupt Program Status Register getter; the current exception
+   * number, 0 in thread mode.
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_ipsr (void);
+
+  /**
+   * Combined Program Status Register getter (APSR, IPSR, EPSR).
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_xpsr (void);
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
+  /**
+   * Main Stack Pointer Limit getter.
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_msplim (void);
+
+  /**
+   * Main Stack Pointer Limit setter; pushes below it raise
+   * a UsageFault (STKOF).
+   */
+  static void
+  cortexm_architecture_set_msplim (cortexm_architecture_register_t limit);
+
+  /**
+   * Process Stack Pointer Limit getter.
+   */
+  static cortexm_architecture_register_t
+  cortexm_architecture_get_psplim (void);
+
+  /**
+   * Process Stack Pointer Limit setter.
+   */
+  static void
+  cortexm_architecture_set_psplim (cortexm_architecture_register_t limit);
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
   // --------------------------------------------------------------------------
-  // Portable architecture assembly instructions in C.
+  // Portable architecture registers getters and mutators in C.
 
   /**
-   * Stack Pointer getter.
+   * Stack Pointer getter; the active stack, MSP or PSP.
    */
   static micro_os_plus_architecture_register_t
   micro_os_plus_architecture_get_sp (void);
 
+  /**
+   * Stack Pointer setter; the active stack, MSP or PSP.
+   */
   static void
   micro_os_plus_architecture_set_sp (
       micro_os_plus_architecture_register_t top_of_stack);
@@ -69,7 +152,7 @@ extern "C"
 namespace cortexm::architecture::registers
 {
   // --------------------------------------------------------------------------
-  // Architecture getters in C++.
+  // Architecture getters and mutators in C++.
 
   /**
    * Main Stack Pointer getter.
@@ -83,24 +166,89 @@ namespace cortexm::architecture::registers
   void
   msp (register_t top_of_main_stack);
 
+  /**
+   * Process Stack Pointer getter.
+   */
+  register_t
+  psp (void);
+
+  /**
+   * Process Stack Pointer setter.
+   */
+  void
+  psp (register_t top_of_process_stack);
+
+  /**
+   * CONTROL register getter.
+   */
+  register_t
+  control (void);
+
+  /**
+   * CONTROL register setter, followed by `isb`.
+   */
+  void
+  control (register_t value);
+
+  /**
+   * IPSR getter.
+   */
+  register_t
+  ipsr (void);
+
+  /**
+   * xPSR getter.
+   */
+  register_t
+  xpsr (void);
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
+  /**
+   * Main Stack Pointer Limit getter.
+   */
+  register_t
+  msplim (void);
+
+  /**
+   * Main Stack Pointer Limit setter.
+   */
+  void
+  msplim (register_t limit);
+
+  /**
+   * Process Stack Pointer Limit getter.
+   */
+  register_t
+  psplim (void);
+
+  /**
+   * Process Stack Pointer Limit setter.
+   */
+  void
+  psplim (register_t limit);
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+
   // --------------------------------------------------------------------------
 } // namespace cortexm::architecture::registers
 
 namespace micro_os_plus::architecture::registers
 {
   // --------------------------------------------------------------------------
-  // Portable architecture assembly instructions in C++.
+  // Portable architecture getters and mutators in C++.
 
   /**
-   * Stack Pointer getter.
+   * Stack Pointer getter; the active stack.
    */
   register_t
   sp (void);
 
   /**
-   * Stack Pointer setter.
+   * Stack Pointer setter; the active stack.
    */
-  void sp (register_t);
+  void
+  sp (register_t top_of_stack);
 
   // --------------------------------------------------------------------------
 } // namespace micro_os_plus::architecture::registers
@@ -109,6 +257,6 @@ namespace micro_os_plus::architecture::registers
 
 // ----------------------------------------------------------------------------
 
-#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_INSTRUCTIONS_H_
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_REGISTERS_H_
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+
+#include <algorithm>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the single producer/single consumer ring
+// buffer; common to all backends, only `dmb()` differs.
+//
+// The `dmb` before an index update makes the elements accesses complete
+// before the other side sees the new index, and the one after reading
+// the head keeps the consumer from reading the elements earlier.
+
+namespace cortexm::architecture
+{
+  // --------------------------------------------------------------------------
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_ring_buffer<T, N>::push (const T& value)
+  {
+    size_type head = head_;
+    if (head - tail_ == capacity)
+      {
+        return false;
+      }
+
+    buffer_[head & mask_] = value;
+
+    dmb ();
+    head_ = head + 1;
+
+    return true;
+  }
+
+  template <typename T, std::size_t N>
+  inline typename spsc_ring_buffer<T, N>::size_type
+  spsc_ring_buffer<T, N>::push_n (const T* values, size_type count)
+  {
+    size_type head = head_;
+    size_type available = capacity - (head - tail_);
+    if (count > available)
+      {
+        count = available;
+      }
+
+    // At most two contiguous copies, before and after the wrap.
+    size_type index = head & mask_;
+    size_type first = std::min (count, capacity - index);
+    std::copy_n (values, first, &buffer_[index]);
+    std::copy_n (values + first, count - first, &buffer_[0]);
+
+    dmb ();
+    head_ = head + count;
+
+    return count;
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) std::span<T>
+  spsc_ring_buffer<T, N>::push_span (void)
+  {
+    size_type head = head_;
+    size_type available = capacity - (head - tail_);
+    size_type index = head & mask_;
+
+    return std::span<T>{ &buffer_[index],
+                         std::min (available, capacity - index) };
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) void
+  spsc_ring_buffer<T, N>::push_commit (size_type count)
+  {
+    dmb ();
+    head_ = head_ + count;
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_ring_buffer<T, N>::pop (T& value)
+  {
+    size_type tail = tail_;
+    if (head_ == tail)
+      {
+        return false;
+      }
+
+    dmb ();
+    value = buffer_[tail & mask_];
+
+    dmb ();
+    tail_ = tail + 1;
+
+    return true;
+  }
+
+  template <typename T, std::size_t N>
+  inline typename spsc_ring_buffer<T, N>::size_type
+  spsc_ring_buffer<T, N>::pop_n (T* values, size_type count)
+  {
+    size_type tail = tail_;
+    size_type available = head_ - tail;
+    if (count > available)
+      {
+        count = available;
+      }
+
+    dmb ();
+
+    size_type index = tail & mask_;
+    size_type first = std::min (count, capacity - index);
+    std::copy_n (&buffer_[index], first, values);
+    std::copy_n (&buffer_[0], count - first, values + first);
+
+    dmb ();
+    tail_ = tail + count;
+
+    return count;
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) std::span<const T>
+  spsc_ring_buffer<T, N>::pop_span (void)
+  {
+    size_type tail = tail_;
+    size_type available = head_ - tail;
+    size_type index = tail & mask_;
+
+    dmb ();
+
+    return std::span<const T>{ &buffer_[index],
+                               std::min (available, capacity - index) };
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) void
+  spsc_ring_buffer<T, N>::pop_commit (size_type count)
+  {
+    dmb ();
+    tail_ = tail_ + count;
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) void
+  spsc_ring_buffer<T, N>::clear (void)
+  {
+    tail_ = head_;
+  }
+
+  // --------------------------------------------------------------------------
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline))
+  typename spsc_ring_buffer<T, N>::size_type
+  spsc_ring_buffer<T, N>::size (void) const
+  {
+    size_type tail = tail_;
+    return head_ - tail;
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_ring_buffer<T, N>::empty (void) const
+  {
+    return size () == 0;
+  }
+
+  template <typename T, std::size_t N>
+  inline __attribute__ ((always_inline)) bool
+  spsc_ring_buffer<T, N>::full (void) const
+  {
+    return size () == capacity;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+// Declarations of the single producer/single consumer ring buffer,
+// to pass data between an interrupt handler and a thread (or the other
+// way around) without locks and without dynamic allocation.
+//
+// The producer writes only the head index and the consumer only the
+// tail index; both are free running 32-bit counters, read and written
+// with single word accesses, and the slot index is obtained by masking
+// them with the power of 2 capacity, so all elements are usable.
+// A `dmb` orders the elements accesses and the index updates.
+
+namespace cortexm::architecture
+{
+  // --------------------------------------------------------------------------
+
+  template <typename T, std::size_t N>
+  class spsc_ring_buffer
+  {
+    static_assert (N >= 2 && (N & (N - 1)) == 0,
+                   "The capacity must be a power of 2");
+    static_assert (N <= (static_cast<std::size_t> (1) << 31),
+                   "The capacity must fit the 32-bit indices");
+    static_assert (std::is_trivially_copyable_v<T>,
+                   "The elements must be trivially copyable");
+
+  public:
+    using value_type = T;
+    using size_type = uint32_t;
+
+    static constexpr size_type capacity = static_cast<size_type> (N);
+
+    constexpr spsc_ring_buffer () = default;
+
+    spsc_ring_buffer (const spsc_ring_buffer&) = delete;
+    spsc_ring_buffer (spsc_ring_buffer&&) = delete;
+    spsc_ring_buffer&
+    operator= (const spsc_ring_buffer&)
+        = delete;
+    spsc_ring_buffer&
+    operator= (spsc_ring_buffer&&)
+        = delete;
+
+    // ------------------------------------------------------------------------
+    // Producer side.
+
+    /**
+     * Append one element; return false if full.
+     */
+    bool
+    push (const T& value);
+
+    /**
+     * Append up to `count` elements; return how many were appended.
+     */
+    size_type
+    push_n (const T* values, size_type count);
+
+    /**
+     * The free space contiguous from the head, to be filled in place
+     * (for example by DMA) and then committed with `push_commit()`;
+     * when the free space wraps, the second part is returned after
+     * the commit.
+     */
+    std::span<T>
+    push_span (void);
+
+    /**
+     * Append `count` elements already written via `push_span()`.
+     */
+    void
+    push_commit (size_type count);
+
+    // ------------------------------------------------------------------------
+    // Consumer side.
+
+    /**
+     * Remove one element; return false if empty.
+     */
+    bool
+    pop (T& value);
+
+    /**
+     * Remove up to `count` elements; return how many were removed.
+     */
+    size_type
+    pop_n (T* values, size_type count);
+
+    /**
+     * The elements contiguous from the tail, to be used in place
+     * (for example as a DMA source) and then released with
+     * `pop_commit()`.
+     */
+    std::span<const T>
+    pop_span (void);
+
+    /**
+     * Remove `count` elements already used via `pop_span()`.
+     */
+    void
+    pop_commit (size_type count);
+
+    /**
+     * Remove all elements.
+     */
+    void
+    clear (void);
+
+    // ------------------------------------------------------------------------
+    // Both sides; the result may be outdated by the other side.
+
+    size_type
+    size (void) const;
+
+    bool
+    empty (void) const;
+
+    bool
+    full (void) const;
+
+  protected:
+    static constexpr size_type mask_ = capacity - 1;
+
+    // Next to each other, in one bus access range; the buffer starts
+    // on a separate cache line, so the cache maintenance of the spans
+    // passed to DMA does not touch them.
+    volatile size_type head_ = 0;
+    volatile size_type tail_ = 0;
+
+    alignas (CORTEXM_ARCHITECTURE_CACHE_LINE_SIZE) T buffer_[N];
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+
+  template <typename T, std::size_t N>
+  using spsc_ring_buffer = cortexm::architecture::spsc_ring_buffer<T, N>;
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_RING_BUFFER_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,282 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/semihosting-file.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the host file operations; the
+// semihosting call is the one of the selected architecture.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_semihosting_handle_t
+  micro_os_plus_semihosting_file_open (const char* path, int mode)
+  {
+    micro_os_plus_semihosting_param_block_t block[3] = {
+      (micro_os_plus_semihosting_param_block_t)path,
+      (micro_os_plus_semihosting_param_block_t)mode,
+      (micro_os_plus_semihosting_param_block_t)strlen (path),
+    };
+    return micro_os_plus_semihosting_call_host (
+        MICRO_OS_PLUS_SEMIHOSTING_SYS_OPEN, block);
+  }
+
+  static inline __attribute__ ((always_inline)) int
+  micro_os_plus_semihosting_file_close (
+      micro_os_plus_semihosting_handle_t handle)
+  {
+    micro_os_plus_semihosting_param_block_t block[1] = {
+      (micro_os_plus_semihosting_param_block_t)handle,
+    };
+    return (int)micro_os_plus_semihosting_call_host (
+        MICRO_OS_PLUS_SEMIHOSTING_SYS_CLOSE, block);
+  }
+
+  static inline size_t
+  micro_os_plus_semihosting_file_read (
+      micro_os_plus_semihosting_handle_t handle, void* buffer, size_t size)
+  {
+    size_t done = 0;
+    while (done < size)
+      {
+        micro_os_plus_semihosting_param_block_t block[3] = {
+          (micro_os_plus_semihosting_param_block_t)handle,
+          (micro_os_plus_semihosting_param_block_t)((char*)buffer + done),
+          (micro_os_plus_semihosting_param_block_t)(size - done),
+        };
+        // The number of bytes not read; all of them at the end of the
+        // file or on errors.
+        micro_os_plus_semihosting_response_t remaining
+            = micro_os_plus_semihosting_call_host (
+                MICRO_OS_PLUS_SEMIHOSTING_SYS_READ, block);
+        if (remaining < 0 || (size_t)remaining >= size - done)
+          {
+            break;
+          }
+        done = size - (size_t)remaining;
+      }
+    return done;
+  }
+
+  static inline __attribute__ ((always_inline)) size_t
+  micro_os_plus_semihosting_file_write (
+      micro_os_plus_semihosting_handle_t handle, const void* buffer,
+      size_t size)
+  {
+    micro_os_plus_semihosting_param_block_t block[3] = {
+      (micro_os_plus_semihosting_param_block_t)handle,
+      (micro_os_plus_semihosting_param_block_t)buffer,
+      (micro_os_plus_semihosting_param_block_t)size,
+    };
+    // The number of bytes not written.
+    micro_os_plus_semihosting_response_t remaining
+        = micro_os_plus_semihosting_call_host (
+            MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE, block);
+    if (remaining < 0 || (size_t)remaining > size)
+      {
+        return 0;
+      }
+    return size - (size_t)remaining;
+  }
+
+  static inline __attribute__ ((always_inline)) int
+  micro_os_plus_semihosting_file_seek (
+      micro_os_plus_semihosting_handle_t handle, size_t position)
+  {
+    micro_os_plus_semihosting_param_block_t block[2] = {
+      (micro_os_plus_semihosting_param_block_t)handle,
+      (micro_os_plus_semihosting_param_block_t)position,
+    };
+    return (int)micro_os_plus_semihosting_call_host (
+        MICRO_OS_PLUS_SEMIHOSTING_SYS_SEEK, block);
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_semihosting_response_t
+  micro_os_plus_semihosting_file_length (
+      micro_os_plus_semihosting_handle_t handle)
+  {
+    micro_os_plus_semihosting_param_block_t block[1] = {
+      (micro_os_plus_semihosting_param_block_t)handle,
+    };
+    return micro_os_plus_semihosting_call_host (
+        MICRO_OS_PLUS_SEMIHOSTING_SYS_FLEN, block);
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_semihosting_reader_initialize (
+      micro_os_plus_semihosting_reader_t* reader,
+      micro_os_plus_semihosting_handle_t handle, void* buffer0,
+      void* buffer1, size_t block_size)
+  {
+    reader->handle = handle;
+    reader->buffers[0] = buffer0;
+    reader->buffers[1] = buffer1;
+    reader->block_size = block_size;
+    reader->lengths[0] = 0;
+    reader->lengths[1] = 0;
+    reader->head = 0;
+    reader->tail = 0;
+    reader->holding = false;
+    reader->end = (handle < 0);
+  }
+
+  static inline bool
+  micro_os_plus_semihosting_reader_prefetch (
+      micro_os_plus_semihosting_reader_t* reader)
+  {
+    // Both buffers are either ready or held by the caller.
+    if (reader->end || (reader->head - reader->tail) >= 2)
+      {
+        return false;
+      }
+
+    uint32_t index = reader->head & 1;
+    size_t length
+        = micro_os_plus_semihosting_file_read (reader->handle,
+                                               reader->buffers[index],
+                                               reader->block_size);
+    if (length < reader->block_size)
+      {
+        reader->end = true;
+      }
+    if (length == 0)
+      {
+        return false;
+      }
+
+    reader->lengths[index] = length;
+    reader->head++;
+    return true;
+  }
+
+  static inline const void*
+  micro_os_plus_semihosting_reader_next (
+      micro_os_plus_semihosting_reader_t* reader, size_t* length)
+  {
+    if (reader->holding)
+      {
+        reader->tail++;
+        reader->holding = false;
+      }
+
+    if (reader->head == reader->tail
+        && !micro_os_plus_semihosting_reader_prefetch (reader))
+      {
+        *length = 0;
+        return NULL;
+      }
+
+    reader->holding = true;
+    *length = reader->lengths[reader->tail & 1];
+    return reader->buffers[reader->tail & 1];
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace micro_os_plus::semihosting
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) handle_t
+  open (const char* path, int mode)
+  {
+    return micro_os_plus_semihosting_file_open (path, mode);
+  }
+
+  inline __attribute__ ((always_inline)) int
+  close (handle_t handle)
+  {
+    return micro_os_plus_semihosting_file_close (handle);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  read (handle_t handle, void* buffer, size_t size)
+  {
+    return micro_os_plus_semihosting_file_read (handle, buffer, size);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  write (handle_t handle, const void* buffer, size_t size)
+  {
+    return micro_os_plus_semihosting_file_write (handle, buffer, size);
+  }
+
+  inline __attribute__ ((always_inline)) int
+  seek (handle_t handle, size_t position)
+  {
+    return micro_os_plus_semihosting_file_seek (handle, position);
+  }
+
+  inline __attribute__ ((always_inline)) micro_os_plus_semihosting_response_t
+  length (handle_t handle)
+  {
+    return micro_os_plus_semihosting_file_length (handle);
+  }
+
+  // --------------------------------------------------------------------------
+
+  inline block_reader::block_reader (handle_t handle, void* buffer0,
+                                     void* buffer1, size_t block_size)
+  {
+    micro_os_plus_semihosting_reader_initialize (&reader_, handle, buffer0,
+                                                 buffer1, block_size);
+  }
+
+  inline bool
+  block_reader::prefetch (void)
+  {
+    return micro_os_plus_semihosting_reader_prefetch (&reader_);
+  }
+
+  inline const void*
+  block_reader::next (size_t& length)
+  {
+    return micro_os_plus_semihosting_reader_next (&reader_, &length);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::semihosting
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_INLINES_H_
+
+// ----------------------------------------------------------------------------
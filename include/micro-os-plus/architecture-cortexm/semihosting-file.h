@@ -0,0 +1,245 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/semihosting.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Typed host file operations, built on the semihosting call.
+//
+// The data is transferred by the host directly to/from the caller
+// buffers; each call halts the core while the host performs it, so
+// the buffers should be as large as possible, and word aligned.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  // The host file handle; negative on errors.
+  typedef micro_os_plus_semihosting_response_t
+      micro_os_plus_semihosting_handle_t;
+
+  // The SYS_OPEN modes, the equivalent of the fopen() modes.
+  enum micro_os_plus_semihosting_open_modes_e
+  {
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_R = 0,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_RB = 1,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_R_PLUS = 2,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_R_PLUS_B = 3,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_W = 4,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_WB = 5,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_W_PLUS = 6,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_W_PLUS_B = 7,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_A = 8,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_AB = 9,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_A_PLUS = 10,
+    MICRO_OS_PLUS_SEMIHOSTING_OPEN_A_PLUS_B = 11,
+  };
+
+  /**
+   * Open a host file; ":tt" is the host console. Returns the handle,
+   * or -1.
+   */
+  static micro_os_plus_semihosting_handle_t
+  micro_os_plus_semihosting_file_open (const char* path, int mode);
+
+  /**
+   * Close a host file. Returns 0, or -1.
+   */
+  static int
+  micro_os_plus_semihosting_file_close (
+      micro_os_plus_semihosting_handle_t handle);
+
+  /**
+   * Read up to size bytes into the buffer, repeating the call if the
+   * host returns less. Returns the number of bytes read, less than
+   * size only at the end of the file.
+   */
+  static size_t
+  micro_os_plus_semihosting_file_read (
+      micro_os_plus_semihosting_handle_t handle, void* buffer, size_t size);
+
+  /**
+   * Write the buffer. Returns the number of bytes written.
+   */
+  static size_t
+  micro_os_plus_semihosting_file_write (
+      micro_os_plus_semihosting_handle_t handle, const void* buffer,
+      size_t size);
+
+  /**
+   * Move to an absolute position. Returns 0, or a negative value.
+   */
+  static int
+  micro_os_plus_semihosting_file_seek (
+      micro_os_plus_semihosting_handle_t handle, size_t position);
+
+  /**
+   * The length of the file, or -1.
+   */
+  static micro_os_plus_semihosting_response_t
+  micro_os_plus_semihosting_file_length (
+      micro_os_plus_semihosting_handle_t handle);
+
+  // --------------------------------------------------------------------------
+  // Block reader.
+  //
+  // Streams a file in blocks, alternating two caller buffers: the
+  // block returned by next() remains valid until the following
+  // call, while prefetch() reads ahead into the other buffer, so
+  // the application can issue the read of the next block when it
+  // suits it (for example before starting to process the current one,
+  // or from the idle loop).
+
+  typedef struct micro_os_plus_semihosting_reader_s
+  {
+    micro_os_plus_semihosting_handle_t handle;
+    void* buffers[2];
+    size_t block_size;
+    size_t lengths[2];
+    // Free running counters of the blocks read and released.
+    uint32_t head;
+    uint32_t tail;
+    bool holding;
+    bool end;
+  } micro_os_plus_semihosting_reader_t;
+
+  /**
+   * Prepare a reader for an open file; the two buffers have
+   * block_size bytes each.
+   */
+  static void
+  micro_os_plus_semihosting_reader_initialize (
+      micro_os_plus_semihosting_reader_t* reader,
+      micro_os_plus_semihosting_handle_t handle, void* buffer0,
+      void* buffer1, size_t block_size);
+
+  /**
+   * Read the next block into the free buffer, if any.
+   * Returns true if a block was read.
+   */
+  static bool
+  micro_os_plus_semihosting_reader_prefetch (
+      micro_os_plus_semihosting_reader_t* reader);
+
+  /**
+   * Release the current block and return the next one, reading it if
+   * it was not prefetched. Returns NULL at the end of the file.
+   */
+  static const void*
+  micro_os_plus_semihosting_reader_next (
+      micro_os_plus_semihosting_reader_t* reader, size_t* length);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace micro_os_plus::semihosting
+{
+  // --------------------------------------------------------------------------
+  // Host files in C++.
+
+  using handle_t = micro_os_plus_semihosting_handle_t;
+
+  /**
+   * Open a host file.
+   */
+  handle_t
+  open (const char* path, int mode);
+
+  /**
+   * Close a host file.
+   */
+  int
+  close (handle_t handle);
+
+  /**
+   * Read up to size bytes.
+   */
+  size_t
+  read (handle_t handle, void* buffer, size_t size);
+
+  /**
+   * Write the buffer.
+   */
+  size_t
+  write (handle_t handle, const void* buffer, size_t size);
+
+  /**
+   * Move to an absolute position.
+   */
+  int
+  seek (handle_t handle, size_t position);
+
+  /**
+   * The length of the file.
+   */
+  micro_os_plus_semihosting_response_t
+  length (handle_t handle);
+
+  /**
+   * Streams a file in blocks, alternating two buffers.
+   */
+  class block_reader
+  {
+  public:
+    block_reader (handle_t handle, void* buffer0, void* buffer1,
+                  size_t block_size);
+
+    block_reader (const block_reader&) = delete;
+    block_reader&
+    operator= (const block_reader&)
+        = delete;
+
+    /**
+     * Read the next block into the free buffer, if any.
+     */
+    bool
+    prefetch (void);
+
+    /**
+     * Release the current block and return the next one, or nullptr.
+     */
+    const void*
+    next (size_t& length);
+
+  protected:
+    micro_os_plus_semihosting_reader_t reader_;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::semihosting
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_FILE_H_
+
+// ----------------------------------------------------------------------------
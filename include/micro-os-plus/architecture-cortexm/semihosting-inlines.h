@@ -15,6 +15,8 @@
 
 // ----------------------------------------------------------------------------
 
+#include <micro-os-plus/architecture-cortexm/semihosting.h>
+
 #include <stdint.h>
 
 // ----------------------------------------------------------------------------
@@ -27,13 +29,6 @@ extern "C"
 
   // --------------------------------------------------------------------------
 
-  // Type of each entry in a parameter block.
-  typedef micro_os_plus_architecture_register_t
-      micro_os_plus_semihosting_param_block_t;
-  // Type of result.
-  typedef micro_os_plus_architecture_signed_register_t
-      micro_os_plus_semihosting_response_t;
-
 #ifdef __thumb__
 #define AngelSWI 0xAB
 #define AngelSWIInsn "bkpt"
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::semihosting_output
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) size_t
+  write (const void* buffer, size_t size)
+  {
+    return cortexm_architecture_semihosting_output_write (buffer, size);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  puts (const char* string)
+  {
+    return cortexm_architecture_semihosting_output_puts (string);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  flush (void)
+  {
+    cortexm_architecture_semihosting_output_flush ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  flush_synchronous (void)
+  {
+    cortexm_architecture_semihosting_output_flush_synchronous ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  idle (void)
+  {
+    cortexm_architecture_semihosting_output_idle ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  dropped (void)
+  {
+    return cortexm_architecture_semihosting_output_dropped ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::semihosting_output
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Buffered semihosting output, when
+// MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT is defined.
+//
+// Each semihosting call halts the core until the debugger services
+// it; the writes are collected in a RAM ring and passed to the host
+// with one SYS_WRITE per contiguous block, when the ring is filled
+// above a threshold, when the application is idle, or on request.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Semihosting output in C.
+
+  /**
+   * Append the bytes to the ring; callable from threads and handlers.
+   * When the ring is full, the bytes which do not fit are dropped.
+   * Returns the number of bytes accepted.
+   */
+  size_t
+  cortexm_architecture_semihosting_output_write (const void* buffer,
+                                                 size_t size);
+
+  /**
+   * Append a zero terminated string.
+   */
+  size_t
+  cortexm_architecture_semihosting_output_puts (const char* string);
+
+  /**
+   * Pass the buffered bytes to the host; if another context is already
+   * flushing, return and leave the bytes to it.
+   */
+  void
+  cortexm_architecture_semihosting_output_flush (void);
+
+  /**
+   * Pass the buffered bytes to the host with the interrupts disabled,
+   * even if the flush was interrupted; for the fault handlers and the
+   * exit paths.
+   */
+  void
+  cortexm_architecture_semihosting_output_flush_synchronous (void);
+
+  /**
+   * Flush, then wait for an interrupt; for the idle loops.
+   */
+  void
+  cortexm_architecture_semihosting_output_idle (void);
+
+  /**
+   * The number of bytes dropped since the startup, because the ring
+   * was full or the host console could not be opened.
+   */
+  uint32_t
+  cortexm_architecture_semihosting_output_dropped (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::semihosting_output
+{
+  // --------------------------------------------------------------------------
+  // Semihosting output in C++.
+
+  /**
+   * Append the bytes to the ring.
+   */
+  size_t
+  write (const void* buffer, size_t size);
+
+  /**
+   * Append a zero terminated string.
+   */
+  size_t
+  puts (const char* string);
+
+  /**
+   * Pass the buffered bytes to the host.
+   */
+  void
+  flush (void);
+
+  /**
+   * Pass the buffered bytes to the host, from a fault handler.
+   */
+  void
+  flush_synchronous (void);
+
+  /**
+   * Flush, then wait for an interrupt.
+   */
+  void
+  idle (void);
+
+  /**
+   * The number of bytes dropped.
+   */
+  uint32_t
+  dropped (void);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::semihosting_output
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_OUTPUT_H_
+
+// ----------------------------------------------------------------------------
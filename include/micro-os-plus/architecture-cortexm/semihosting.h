@@ -0,0 +1,114 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2020 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/types.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the semihosting call.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  // Type of each entry in a parameter block.
+  typedef micro_os_plus_architecture_register_t
+      micro_os_plus_semihosting_param_block_t;
+  // Type of result.
+  typedef micro_os_plus_architecture_signed_register_t
+      micro_os_plus_semihosting_response_t;
+
+  // Semihosting operation numbers, as defined by the Arm
+  // "Semihosting for AArch32 and AArch64" specification.
+  enum micro_os_plus_semihosting_operation_numbers_e
+  {
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_OPEN = 0x01,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_CLOSE = 0x02,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITEC = 0x03,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0 = 0x04,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE = 0x05,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_READ = 0x06,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_READC = 0x07,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_ISERROR = 0x08,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_ISTTY = 0x09,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_SEEK = 0x0A,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_FLEN = 0x0C,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_TMPNAM = 0x0D,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_REMOVE = 0x0E,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_RENAME = 0x0F,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_CLOCK = 0x10,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_TIME = 0x11,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_SYSTEM = 0x12,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_ERRNO = 0x13,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_GET_CMDLINE = 0x15,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_HEAPINFO = 0x16,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_EXIT = 0x18,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_EXIT_EXTENDED = 0x20,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_ELAPSED = 0x30,
+    MICRO_OS_PLUS_SEMIHOSTING_SYS_TICKFREQ = 0x31,
+  };
+
+  // Reason codes used by SYS_EXIT, the ADP_Stopped_* values.
+  enum micro_os_plus_semihosting_exit_reasons_e
+  {
+    // The hardware exceptions.
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_BRANCH_THROUGH_ZERO = 0x20000,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_UNDEFINED_INSTR = 0x20001,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_SOFTWARE_INTERRUPT = 0x20002,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_PREFETCH_ABORT = 0x20003,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_DATA_ABORT = 0x20004,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_ADDRESS_EXCEPTION = 0x20005,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_IRQ = 0x20006,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_FIQ = 0x20007,
+
+    // The software reasons.
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_BREAK_POINT = 0x20020,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_WATCH_POINT = 0x20021,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_STEP_COMPLETE = 0x20022,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_RUN_TIME_ERROR_UNKNOWN = 0x20023,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_INTERNAL_ERROR = 0x20024,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_USER_INTERRUPTION = 0x20025,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_APPLICATION_EXIT = 0x20026,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_STACK_OVERFLOW = 0x20027,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_DIVISION_BY_ZERO = 0x20028,
+    MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_OS_SPECIFIC = 0x20029,
+  };
+
+  /**
+   * Perform a semihosting call; the reason is one of the operation
+   * numbers, and arg is a pointer to a parameter block, or a
+   * value, depending on the operation.
+   */
+  static micro_os_plus_semihosting_response_t
+  micro_os_plus_semihosting_call_host (
+      int reason, micro_os_plus_semihosting_param_block_t* arg);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SEMIHOSTING_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::stack
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  paint (uint32_t* bottom, uint32_t* top)
+  {
+    cortexm_architecture_stack_paint (bottom, top);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  paint_main (void)
+  {
+    cortexm_architecture_stack_paint_main ();
+  }
+
+  inline __attribute__ ((always_inline)) descriptor_t
+  main_stack (void)
+  {
+    return cortexm_architecture_stack_main ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  used (const uint32_t* bottom, const uint32_t* top)
+  {
+    return cortexm_architecture_stack_used (bottom, top);
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  used_fast (const uint32_t* bottom, const uint32_t* top)
+  {
+    return cortexm_architecture_stack_used_fast (bottom, top);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  report (const descriptor_t* stacks, uint32_t count)
+  {
+    cortexm_architecture_stack_report (stacks, count);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::stack
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Stack usage measurements.
+//
+// The stacks are painted with MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC
+// and the high-water mark is found by scanning from the far end (the
+// bottom, since the stacks grow down) up to the first overwritten word.
+// The main stack is also the interrupts stack, once the threads run
+// on PSP.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * A stack to be reported, [bottom, top).
+   */
+  typedef struct cortexm_architecture_stack_descriptor_s
+  {
+    const char* name;
+    uint32_t* bottom;
+    uint32_t* top;
+  } cortexm_architecture_stack_descriptor_t;
+
+  // --------------------------------------------------------------------------
+  // Stack usage in C.
+
+  /**
+   * Paint the [bottom, top) range, with 8-word stores.
+   */
+  void
+  cortexm_architecture_stack_paint (uint32_t* bottom, uint32_t* top);
+
+  /**
+   * Paint the unused part of the main stack, from its bottom up to the
+   * current stack pointer; to be called early by the reset handler.
+   */
+  void
+  cortexm_architecture_stack_paint_main (void);
+
+  /**
+   * The main stack, as defined by the linker scripts.
+   */
+  cortexm_architecture_stack_descriptor_t
+  cortexm_architecture_stack_main (void);
+
+  /**
+   * The maximum number of bytes used, exact; the time is proportional
+   * to the unused part.
+   */
+  uint32_t
+  cortexm_architecture_stack_used (const uint32_t* bottom,
+                                   const uint32_t* top);
+
+  /**
+   * The maximum number of bytes used, found with a binary search over
+   * 32-byte blocks, in logarithmic time; cheap enough to be called
+   * periodically, but it may report less when the used part has large
+   * blocks of words never written (for example unused local buffers).
+   */
+  uint32_t
+  cortexm_architecture_stack_used_fast (const uint32_t* bottom,
+                                        const uint32_t* top);
+
+  /**
+   * Write one `MICRO_OS_PLUS_STACK <name> <used> <size>` line per stack
+   * via semihosting, with the exact usage.
+   */
+  void
+  cortexm_architecture_stack_report (
+      const cortexm_architecture_stack_descriptor_t* stacks, uint32_t count);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::stack
+{
+  // --------------------------------------------------------------------------
+  // Stack usage in C++.
+
+  using descriptor_t = cortexm_architecture_stack_descriptor_t;
+
+  /**
+   * Paint the [bottom, top) range.
+   */
+  void
+  paint (uint32_t* bottom, uint32_t* top);
+
+  /**
+   * Paint the unused part of the main stack.
+   */
+  void
+  paint_main (void);
+
+  /**
+   * The main stack.
+   */
+  descriptor_t
+  main_stack (void);
+
+  /**
+   * The maximum number of bytes used, exact.
+   */
+  uint32_t
+  used (const uint32_t* bottom, const uint32_t* top);
+
+  /**
+   * The maximum number of bytes used, with a binary search.
+   */
+  uint32_t
+  used_fast (const uint32_t* bottom, const uint32_t* top);
+
+  /**
+   * Write the usage of the stacks via semihosting.
+   */
+  void
+  report (const descriptor_t* stacks, uint32_t count);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::stack
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STACK_H_
+
+// ----------------------------------------------------------------------------
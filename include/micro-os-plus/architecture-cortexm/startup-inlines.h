@@ -0,0 +1,124 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the Cortex-M startup.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_startup_initialize_stack_limit (void)
+  {
+#if defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+    cortexm_architecture_set_msplim (
+        (cortexm_architecture_register_t)&__stack
+        - (cortexm_architecture_register_t)&__stack_size
+        + MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMIT_RESERVE);
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+    CORTEXM_ARCHITECTURE_SCB_SHCSR
+        = CORTEXM_ARCHITECTURE_SCB_SHCSR
+          | CORTEXM_ARCHITECTURE_SCB_SHCSR_USGFAULTENA;
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_STACK_LIMITS)
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_startup_initialize_vectors (void)
+  {
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+    cortexm_architecture_vectors_relocate ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::startup
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  copy_words (const uint32_t* from, uint32_t* region_begin,
+              uint32_t* region_end)
+  {
+    cortexm_architecture_startup_copy_words (from, region_begin, region_end);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  zero_words (uint32_t* region_begin, uint32_t* region_end)
+  {
+    cortexm_architecture_startup_zero_words (region_begin, region_end);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  decompress_words (const uint8_t* from, uint32_t* region_begin,
+                    uint32_t* region_end)
+  {
+    cortexm_architecture_startup_decompress_words (from, region_begin,
+                                                   region_end);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  initialize_data (void)
+  {
+    cortexm_architecture_startup_initialize_data ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  initialize_bss (void)
+  {
+    cortexm_architecture_startup_initialize_bss ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  initialize_stack_limit (void)
+  {
+    cortexm_architecture_startup_initialize_stack_limit ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  initialize_vectors (void)
+  {
+    cortexm_architecture_startup_initialize_vectors ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,199 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+// Set in the `from` word of a .mem_inits data record by
+// `scripts/compress-data.py`, when the image is an LZ4 block.
+#define CORTEXM_ARCHITECTURE_STARTUP_DATA_COMPRESSED (0x1UL)
+
+// The space left below the MSPLIM limit for the stack overflow
+// handler, which lowers the limit to the bottom of the stack.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMIT_RESERVE)
+#define MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMIT_RESERVE (128)
+#endif
+
+// ----------------------------------------------------------------------------
+// Declarations of the Cortex-M startup memory initialisation functions.
+//
+// They are called by the reset handler, before the .data and .bss
+// sections are initialised, so they do not use any static storage.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Linker script definitions.
+
+  // Records of (from, region_begin, region_end) words.
+  extern uint32_t __data_regions_array_begin__;
+  extern uint32_t __data_regions_array_end__;
+
+  // Records of (region_begin, region_end) words.
+  extern uint32_t __bss_regions_array_begin__;
+  extern uint32_t __bss_regions_array_end__;
+
+  // The main stack, [__stack - __stack_size, __stack).
+  extern uint32_t __stack;
+  extern uint32_t __stack_size;
+
+  // The beginning of the RAM with the thread stacks; weak, since
+  // the custom linker scripts may not define it (then its address
+  // is 0).
+  extern uint32_t __ram_begin__ __attribute__ ((weak));
+
+  // --------------------------------------------------------------------------
+  // Memory initialisation in C.
+
+  /**
+   * Copy words from `from` to the [region_begin, region_end) range.
+   * All addresses must be word aligned.
+   *
+   * On ARMv7-M/ARMv8-M Mainline it uses 8-word LDM/STM bursts,
+   * on ARMv6-M/ARMv8-M Baseline 4-word bursts.
+   */
+  void
+  cortexm_architecture_startup_copy_words (const uint32_t* from,
+                                           uint32_t* region_begin,
+                                           uint32_t* region_end);
+
+  /**
+   * Clear the [region_begin, region_end) range, with the same
+   * bursts as the copy. Both addresses must be word aligned.
+   */
+  void
+  cortexm_architecture_startup_zero_words (uint32_t* region_begin,
+                                           uint32_t* region_end);
+
+  /**
+   * Decompress the LZ4 block at `from` into the
+   * [region_begin, region_end) range; `from` may be unaligned.
+   */
+  void
+  cortexm_architecture_startup_decompress_words (const uint8_t* from,
+                                                 uint32_t* region_begin,
+                                                 uint32_t* region_end);
+
+  /**
+   * Copy or decompress all records of the .mem_inits data array;
+   * records already at their load address (RAM only configurations)
+   * are skipped.
+   */
+  void
+  cortexm_architecture_startup_initialize_data (void);
+
+  /**
+   * Clear all records of the .mem_inits bss array.
+   */
+  void
+  cortexm_architecture_startup_initialize_bss (void);
+
+  /**
+   * On ARMv8-M, set MSPLIM to the bottom of the main stack plus
+   * MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMIT_RESERVE, so an overflow
+   * raises a UsageFault (STKOF), enabled here, or a HardFault on
+   * ARMv8-M Baseline. Does nothing on the other architectures.
+   * To be called first by the reset handler.
+   */
+  static void
+  cortexm_architecture_startup_initialize_stack_limit (void);
+
+  /**
+   * With MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS, copy the vector
+   * table to `.ram_vectors` and point VTOR to it; does nothing
+   * otherwise. To be called by the reset handler before enabling the
+   * interrupts.
+   */
+  static void
+  cortexm_architecture_startup_initialize_vectors (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::startup
+{
+  // --------------------------------------------------------------------------
+  // Memory initialisation in C++.
+
+  /**
+   * Copy words from `from` to the [region_begin, region_end) range.
+   */
+  void
+  copy_words (const uint32_t* from, uint32_t* region_begin,
+              uint32_t* region_end);
+
+  /**
+   * Clear the [region_begin, region_end) range.
+   */
+  void
+  zero_words (uint32_t* region_begin, uint32_t* region_end);
+
+  /**
+   * Decompress the LZ4 block at `from` into the
+   * [region_begin, region_end) range.
+   */
+  void
+  decompress_words (const uint8_t* from, uint32_t* region_begin,
+                    uint32_t* region_end);
+
+  /**
+   * Initialise all .data regions.
+   */
+  void
+  initialize_data (void);
+
+  /**
+   * Clear all .bss regions.
+   */
+  void
+  initialize_bss (void);
+
+  /**
+   * Set the main stack limit, on ARMv8-M.
+   */
+  void
+  initialize_stack_limit (void);
+
+  /**
+   * Move the vector table to RAM, if configured.
+   */
+  void
+  initialize_vectors (void);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::startup
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_STARTUP_H_
+
+// ----------------------------------------------------------------------------
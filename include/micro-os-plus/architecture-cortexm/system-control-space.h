@@ -0,0 +1,245 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SYSTEM_CONTROL_SPACE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SYSTEM_CONTROL_SPACE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Memory mapped core registers, as named in the Arm v7-M/v8-M
+// Architecture Reference Manuals.
+//
+// Only the registers used by this package are defined; the full
+// definitions are available in the CMSIS Core headers.
+
+#define CORTEXM_ARCHITECTURE_REGISTER(address) \
+  (*(volatile uint32_t*)(address))
+
+// ----------------------------------------------------------------------------
+// System Control Block.
+
+// Interrupt Control and State Register.
+#define CORTEXM_ARCHITECTURE_SCB_ICSR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED04UL)
+#define CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSVSET (1UL << 28)
+#define CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET (1UL << 26)
+#define CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTCLR (1UL << 25)
+
+// Vector Table Offset Register.
+#define CORTEXM_ARCHITECTURE_SCB_VTOR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED08UL)
+
+// Application Interrupt and Reset Control Register; the writes must
+// include the key.
+#define CORTEXM_ARCHITECTURE_SCB_AIRCR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED0CUL)
+#define CORTEXM_ARCHITECTURE_SCB_AIRCR_VECTKEY (0x05FAUL << 16)
+#define CORTEXM_ARCHITECTURE_SCB_AIRCR_SYSRESETREQ (1UL << 2)
+#define CORTEXM_ARCHITECTURE_SCB_AIRCR_PRIGROUP_SHIFT (8)
+#define CORTEXM_ARCHITECTURE_SCB_AIRCR_PRIGROUP_MASK (0x7UL << 8)
+
+// System Control Register.
+#define CORTEXM_ARCHITECTURE_SCB_SCR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED10UL)
+#define CORTEXM_ARCHITECTURE_SCB_SCR_SLEEPDEEP (1UL << 2)
+#define CORTEXM_ARCHITECTURE_SCB_SCR_SEVONPEND (1UL << 4)
+
+// Configuration and Control Register; the cache enable bits read as
+// zero on the cores without caches.
+#define CORTEXM_ARCHITECTURE_SCB_CCR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED14UL)
+#define CORTEXM_ARCHITECTURE_SCB_CCR_DC (1UL << 16)
+#define CORTEXM_ARCHITECTURE_SCB_CCR_IC (1UL << 17)
+
+// System Handler Priority Registers, one byte per exception, from
+// MemManage (4) to SysTick (15); word access only on ARMv6-M, where
+// SHPR1 is not present.
+#define CORTEXM_ARCHITECTURE_SCB_SHPR(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED18UL + 4 * (n))
+
+// System Handler Priority Register 3 (PendSV and SysTick priorities).
+#define CORTEXM_ARCHITECTURE_SCB_SHPR3 \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED20UL)
+#define CORTEXM_ARCHITECTURE_SCB_SHPR3_PRI_PENDSV (0xFFUL << 16)
+
+// System Handler Control and State Register.
+#define CORTEXM_ARCHITECTURE_SCB_SHCSR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED24UL)
+#define CORTEXM_ARCHITECTURE_SCB_SHCSR_MEMFAULTENA (1UL << 16)
+#define CORTEXM_ARCHITECTURE_SCB_SHCSR_USGFAULTENA (1UL << 18)
+
+// Configurable Fault Status Register (MMFSR, BFSR, UFSR); the bits
+// are cleared by writing 1.
+#define CORTEXM_ARCHITECTURE_SCB_CFSR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED28UL)
+#define CORTEXM_ARCHITECTURE_SCB_CFSR_IACCVIOL (1UL << 0)
+#define CORTEXM_ARCHITECTURE_SCB_CFSR_IBUSERR (1UL << 8)
+#define CORTEXM_ARCHITECTURE_SCB_CFSR_INVSTATE (1UL << 17)
+#define CORTEXM_ARCHITECTURE_SCB_CFSR_STKOF (1UL << 20) // ARMv8-M
+
+// HardFault Status Register (ARMv7-M, ARMv8-M Mainline).
+#define CORTEXM_ARCHITECTURE_SCB_HFSR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED2CUL)
+
+// MemManage and BusFault Address Registers, valid when the MMARVALID
+// and BFARVALID bits are set in CFSR (ARMv7-M, ARMv8-M Mainline).
+#define CORTEXM_ARCHITECTURE_SCB_MMFAR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED34UL)
+#define CORTEXM_ARCHITECTURE_SCB_BFAR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED38UL)
+
+// Cache Size ID Register, for the cache selected by CSSELR (cores
+// with caches only).
+#define CORTEXM_ARCHITECTURE_SCB_CCSIDR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED80UL)
+#define CORTEXM_ARCHITECTURE_SCB_CCSIDR_SETS(value) \
+  ((((value) >> 13) & 0x7FFFUL) + 1)
+#define CORTEXM_ARCHITECTURE_SCB_CCSIDR_WAYS(value) \
+  ((((value) >> 3) & 0x3FFUL) + 1)
+
+// Cache Size Selection Register; 0 selects the L1 data cache.
+#define CORTEXM_ARCHITECTURE_SCB_CSSELR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED84UL)
+
+// Coprocessor Access Control Register (FPU cores only).
+#define CORTEXM_ARCHITECTURE_SCB_CPACR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED88UL)
+#define CORTEXM_ARCHITECTURE_SCB_CPACR_CP10_CP11_FULL (0xFUL << 20)
+
+// Floating-point Context Control Register (FPU cores only); LSPACT is
+// set while the space for s0-s15/FPSCR is reserved in an extended
+// frame, but the registers are not yet stored (lazy stacking).
+#define CORTEXM_ARCHITECTURE_FPU_FPCCR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF34UL)
+#define CORTEXM_ARCHITECTURE_FPU_FPCCR_LSPACT (1UL << 0)
+
+// Cache maintenance operations, write only: the instruction cache
+// invalidate all, and the data cache operations by address (MVA, to
+// the point of coherency) or by set/way.
+#define CORTEXM_ARCHITECTURE_SCB_ICIALLU \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF50UL)
+#define CORTEXM_ARCHITECTURE_SCB_DCIMVAC \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF5CUL)
+#define CORTEXM_ARCHITECTURE_SCB_DCISW \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF60UL)
+#define CORTEXM_ARCHITECTURE_SCB_DCCMVAC \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF68UL)
+#define CORTEXM_ARCHITECTURE_SCB_DCCSW \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF6CUL)
+#define CORTEXM_ARCHITECTURE_SCB_DCCIMVAC \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF70UL)
+#define CORTEXM_ARCHITECTURE_SCB_DCCISW \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EF74UL)
+
+// ----------------------------------------------------------------------------
+// Nested Vectored Interrupt Controller.
+
+// One bit per interrupt, 32 interrupts per register; writing 1 sets or
+// clears the bit, writing 0 has no effect.
+#define CORTEXM_ARCHITECTURE_NVIC_ISER(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E100UL + 4 * (n))
+#define CORTEXM_ARCHITECTURE_NVIC_ICER(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E180UL + 4 * (n))
+#define CORTEXM_ARCHITECTURE_NVIC_ISPR(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E200UL + 4 * (n))
+#define CORTEXM_ARCHITECTURE_NVIC_ICPR(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E280UL + 4 * (n))
+
+// Interrupt Priority Registers, one byte per interrupt, 4 per
+// register; word access only on ARMv6-M.
+#define CORTEXM_ARCHITECTURE_NVIC_IPR(n) \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E400UL + 4 * (n))
+
+// ----------------------------------------------------------------------------
+// Memory Protection Unit (ARMv7-M PMSAv7, ARMv8-M PMSAv8).
+
+// MPU Type Register; DREGION is the number of regions.
+#define CORTEXM_ARCHITECTURE_MPU_TYPE \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED90UL)
+#define CORTEXM_ARCHITECTURE_MPU_TYPE_DREGION(value) (((value) >> 8) & 0xFFUL)
+
+// MPU Control Register.
+#define CORTEXM_ARCHITECTURE_MPU_CTRL \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED94UL)
+#define CORTEXM_ARCHITECTURE_MPU_CTRL_ENABLE (1UL << 0)
+#define CORTEXM_ARCHITECTURE_MPU_CTRL_HFNMIENA (1UL << 1)
+#define CORTEXM_ARCHITECTURE_MPU_CTRL_PRIVDEFENA (1UL << 2)
+
+// MPU Region Number Register.
+#define CORTEXM_ARCHITECTURE_MPU_RNR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000ED98UL)
+
+// MPU Region Base Address Register, followed by RASR (ARMv7-M) or
+// RLAR (ARMv8-M) and by three alias pairs, for the regions RNR + 1
+// to RNR + 3 (on ARMv7-M RBAR.VALID selects the region instead).
+#define CORTEXM_ARCHITECTURE_MPU_RBAR_ADDRESS (0xE000ED9CUL)
+#define CORTEXM_ARCHITECTURE_MPU_RBAR_VALID (1UL << 4) // ARMv7-M
+
+// Memory Attribute Indirection Registers (ARMv8-M).
+#define CORTEXM_ARCHITECTURE_MPU_MAIR0 \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EDC0UL)
+#define CORTEXM_ARCHITECTURE_MPU_MAIR1 \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000EDC4UL)
+
+// ----------------------------------------------------------------------------
+// SysTick.
+
+// SysTick Control and Status Register.
+#define CORTEXM_ARCHITECTURE_SYST_CSR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E010UL)
+#define CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE (1UL << 0)
+#define CORTEXM_ARCHITECTURE_SYST_CSR_TICKINT (1UL << 1)
+#define CORTEXM_ARCHITECTURE_SYST_CSR_CLKSOURCE (1UL << 2)
+#define CORTEXM_ARCHITECTURE_SYST_CSR_COUNTFLAG (1UL << 16)
+
+// SysTick Reload Value Register.
+#define CORTEXM_ARCHITECTURE_SYST_RVR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E014UL)
+#define CORTEXM_ARCHITECTURE_SYST_RVR_MAX (0x00FFFFFFUL)
+
+// SysTick Current Value Register.
+#define CORTEXM_ARCHITECTURE_SYST_CVR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE000E018UL)
+
+// ----------------------------------------------------------------------------
+// Debug.
+
+// Debug Exception and Monitor Control Register.
+#define CORTEXM_ARCHITECTURE_DEMCR CORTEXM_ARCHITECTURE_REGISTER (0xE000EDFCUL)
+#define CORTEXM_ARCHITECTURE_DEMCR_TRCENA (1UL << 24)
+
+// ----------------------------------------------------------------------------
+// Data Watchpoint and Trace.
+
+// DWT Control Register.
+#define CORTEXM_ARCHITECTURE_DWT_CTRL \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE0001000UL)
+#define CORTEXM_ARCHITECTURE_DWT_CTRL_CYCCNTENA (1UL << 0)
+#define CORTEXM_ARCHITECTURE_DWT_CTRL_NOCYCCNT (1UL << 25)
+
+// DWT Cycle Count Register.
+#define CORTEXM_ARCHITECTURE_DWT_CYCCNT \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE0001004UL)
+
+// DWT Lock Access Register (Cortex-M7 only; write ignored elsewhere).
+#define CORTEXM_ARCHITECTURE_DWT_LAR \
+  CORTEXM_ARCHITECTURE_REGISTER (0xE0001FB0UL)
+#define CORTEXM_ARCHITECTURE_DWT_LAR_KEY (0xC5ACCE55UL)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_SYSTEM_CONTROL_SPACE_H_
+
+// ----------------------------------------------------------------------------
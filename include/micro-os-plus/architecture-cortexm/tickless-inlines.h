@@ -0,0 +1,146 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  // Without intermediate overflows: the remainders are below 2^32, so
+  // their products fit in 64 bits.
+  static inline __attribute__ ((always_inline)) uint64_t
+  cortexm_architecture_tickless_cycles_to_ns_at (uint64_t cycles,
+                                                 uint32_t clock_hz)
+  {
+    uint64_t seconds = cycles / clock_hz;
+    uint64_t rest = cycles % clock_hz;
+
+    return seconds * 1000000000ULL + (rest * 1000000000ULL) / clock_hz;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  cortexm_architecture_tickless_ns_to_cycles_at (uint64_t ns,
+                                                 uint32_t clock_hz)
+  {
+    uint64_t seconds = ns / 1000000000ULL;
+    uint64_t rest = ns % 1000000000ULL;
+
+    return seconds * clock_hz + (rest * clock_hz) / 1000000000ULL;
+  }
+
+  static inline __attribute__ ((always_inline)) uint64_t
+  cortexm_architecture_tickless_now_ns (void)
+  {
+    return cortexm_architecture_tickless_cycles_to_ns (
+        cortexm_architecture_tickless_now_cycles ());
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::tickless
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  initialize (uint32_t clock_hz)
+  {
+    cortexm_architecture_tickless_initialize (clock_hz);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  now_cycles (void)
+  {
+    return cortexm_architecture_tickless_now_cycles ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  now_ns (void)
+  {
+    return cortexm_architecture_tickless_now_ns ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  cycles_to_ns (uint64_t cycles)
+  {
+    return cortexm_architecture_tickless_cycles_to_ns (cycles);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ns_to_cycles (uint64_t ns)
+  {
+    return cortexm_architecture_tickless_ns_to_cycles (ns);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  cycles_to_ns (uint64_t cycles, uint32_t clock_hz)
+  {
+    return cortexm_architecture_tickless_cycles_to_ns_at (cycles, clock_hz);
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  ns_to_cycles (uint64_t ns, uint32_t clock_hz)
+  {
+    return cortexm_architecture_tickless_ns_to_cycles_at (ns, clock_hz);
+  }
+
+  inline __attribute__ ((always_inline)) void
+  set_deadline (uint64_t deadline)
+  {
+    cortexm_architecture_tickless_set_deadline (deadline);
+  }
+
+  inline __attribute__ ((always_inline)) bool
+  interrupt_handler (void)
+  {
+    return cortexm_architecture_tickless_interrupt_handler ();
+  }
+
+  inline __attribute__ ((always_inline)) uint64_t
+  idle (uint64_t deadline)
+  {
+    return cortexm_architecture_tickless_idle (deadline);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::tickless
+
+#endif // defined(__cplusplus)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,196 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Tickless idle and the 64-bit monotonic clock.
+//
+// With MICRO_OS_PLUS_ARCHITECTURE_TICKLESS, SysTick, clocked by the
+// core, does not interrupt periodically; it is programmed to expire
+// at the next deadline, or after its maximum period (2^24 cycles)
+// when there is none, and the clock is the count of the elapsed
+// periods plus the current SysTick value.
+//
+// The periods which end normally are accounted exactly, since only
+// the reload value of the next period is changed; a period is
+// restarted, losing the few cycles of the register writes, only
+// when a deadline earlier than its end is set.
+//
+// The clock is read without masking the interrupts: the updates, all
+// done with PRIMASK set, are published in one of two copies selected
+// by a generation count, and the readers retry if the count changed.
+// A pending SysTick interrupt means the end of a period, so it must
+// not be pended by software.
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+// The shortest SysTick period, in cycles; it must be longer than the
+// SysTick handler, including its entry latency, since each period
+// must be accounted before the next one ends.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES)
+#define MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES (1000)
+#endif
+
+// No deadline; SysTick only keeps the clock.
+#define CORTEXM_ARCHITECTURE_TICKLESS_NO_DEADLINE (UINT64_MAX)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+  // Tickless idle in C.
+
+  /**
+   * Take over SysTick, clocked by the core at `clock_hz`, and start
+   * the clock from zero, without a deadline. With
+   * MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_USE_WFE, also set
+   * SCR.SEVONPEND, for `wfe` to wake on interrupts.
+   */
+  void
+  cortexm_architecture_tickless_initialize (uint32_t clock_hz);
+
+  /**
+   * Get the cycles since initialisation. Safe to call from threads
+   * and from the handlers with a priority not higher than SysTick.
+   */
+  uint64_t
+  cortexm_architecture_tickless_now_cycles (void);
+
+  /**
+   * Get the nanoseconds since initialisation.
+   */
+  static uint64_t
+  cortexm_architecture_tickless_now_ns (void);
+
+  /**
+   * Convert between cycles and nanoseconds, rounding down, without
+   * intermediate overflows.
+   */
+  uint64_t
+  cortexm_architecture_tickless_cycles_to_ns (uint64_t cycles);
+
+  uint64_t
+  cortexm_architecture_tickless_ns_to_cycles (uint64_t ns);
+
+  /**
+   * The same conversions, for a given clock frequency.
+   */
+  static uint64_t
+  cortexm_architecture_tickless_cycles_to_ns_at (uint64_t cycles,
+                                                 uint32_t clock_hz);
+
+  static uint64_t
+  cortexm_architecture_tickless_ns_to_cycles_at (uint64_t ns,
+                                                 uint32_t clock_hz);
+
+  /**
+   * Program SysTick to interrupt at the given clock value, or, if
+   * already past, as soon as possible; replaces the previous deadline.
+   */
+  void
+  cortexm_architecture_tickless_set_deadline (uint64_t deadline);
+
+  /**
+   * The SysTick work; to be called by `SysTick_Handler()`. Accounts
+   * the period which ended and programs the next one. Returns true
+   * if the deadline was reached, which is then cleared.
+   */
+  bool
+  cortexm_architecture_tickless_interrupt_handler (void);
+
+  /**
+   * Program the deadline and sleep until an interrupt is pending.
+   *
+   * Must be called with PRIMASK set, after checking that there is
+   * nothing to do; the interrupts which occur after the check wake
+   * the core instead of being taken, so they cannot be missed. The
+   * clock is brought up to date before returning, still with PRIMASK
+   * set; the pending handlers run when the caller clears it. BASEPRI
+   * must not mask SysTick, whose end of period wakes the core.
+   * Returns the clock.
+   */
+  uint64_t
+  cortexm_architecture_tickless_idle (uint64_t deadline);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::tickless
+{
+  // --------------------------------------------------------------------------
+  // Tickless idle in C++.
+
+  constexpr uint64_t no_deadline = CORTEXM_ARCHITECTURE_TICKLESS_NO_DEADLINE;
+
+  void
+  initialize (uint32_t clock_hz);
+
+  uint64_t
+  now_cycles (void);
+
+  uint64_t
+  now_ns (void);
+
+  uint64_t
+  cycles_to_ns (uint64_t cycles);
+
+  uint64_t
+  ns_to_cycles (uint64_t ns);
+
+  uint64_t
+  cycles_to_ns (uint64_t cycles, uint32_t clock_hz);
+
+  uint64_t
+  ns_to_cycles (uint64_t ns, uint32_t clock_hz);
+
+  void
+  set_deadline (uint64_t deadline);
+
+  bool
+  interrupt_handler (void);
+
+  /**
+   * Sleep until an interrupt is pending; with PRIMASK set.
+   */
+  uint64_t
+  idle (uint64_t deadline);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::tickless
+
+#endif // defined(__cplusplus)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TICKLESS_H_
+
+// ----------------------------------------------------------------------------
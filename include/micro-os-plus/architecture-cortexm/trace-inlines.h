@@ -0,0 +1,62 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::trace
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  initialize (void)
+  {
+    cortexm_architecture_trace_initialize ();
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  write (uint32_t channel, const void* buffer, size_t size)
+  {
+    return cortexm_architecture_trace_write (channel, buffer, size);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  puts (const char* string)
+  {
+    return cortexm_architecture_trace_puts (string);
+  }
+
+  inline __attribute__ ((always_inline)) size_t
+  read (uint32_t channel, void* buffer, size_t size)
+  {
+    return cortexm_architecture_trace_read (channel, buffer, size);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::trace
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_INLINES_H_
+
+// ----------------------------------------------------------------------------
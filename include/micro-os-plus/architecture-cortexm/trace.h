@@ -0,0 +1,185 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Memory mapped trace channels, when MICRO_OS_PLUS_ARCHITECTURE_TRACE
+// is defined.
+//
+// A control block in the `.trace` section describes ring buffers which
+// the debugger reads (up) and writes (down) over SWD while the core
+// runs; writing a trace message is a copy to RAM, it never halts the
+// core. The layout is the one used by the RTT tools (OpenOCD `rtt`,
+// pyOCD, J-Link), which find the block by its identifier.
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS (1)
+#endif
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS (1)
+#endif
+
+// What to do when an up channel is full.
+#define CORTEXM_ARCHITECTURE_TRACE_MODE_SKIP (0) // Drop the message.
+#define CORTEXM_ARCHITECTURE_TRACE_MODE_TRIM (1) // Write what fits.
+#define CORTEXM_ARCHITECTURE_TRACE_MODE_BLOCK (2) // Wait for the host.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * A ring buffer; the producer writes only write_offset and the
+   * consumer only read_offset; one byte is kept free.
+   */
+  typedef struct cortexm_architecture_trace_channel_s
+  {
+    const char* name;
+    char* buffer;
+    uint32_t size;
+    volatile uint32_t write_offset;
+    volatile uint32_t read_offset;
+    uint32_t flags;
+  } cortexm_architecture_trace_channel_t;
+
+  typedef struct cortexm_architecture_trace_control_s
+  {
+    // Set last by the initialisation.
+    char id[16];
+    int32_t up_channels;
+    int32_t down_channels;
+    cortexm_architecture_trace_channel_t
+        up[MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS];
+    cortexm_architecture_trace_channel_t
+        down[MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS];
+  } cortexm_architecture_trace_control_t;
+
+  /**
+   * The control block, in the `.trace` section.
+   */
+  extern cortexm_architecture_trace_control_t
+      cortexm_architecture_trace_control;
+
+  // --------------------------------------------------------------------------
+  // Trace in C.
+
+  /**
+   * Prepare the control block and the channels 0; to be called once,
+   * early, before any other trace function.
+   */
+  void
+  cortexm_architecture_trace_initialize (void);
+
+  /**
+   * Set an up channel to use the given buffer; the channel 0 has a
+   * default buffer, the others must be configured before being used.
+   */
+  void
+  cortexm_architecture_trace_configure_up_channel (uint32_t channel,
+                                                   const char* name,
+                                                   void* buffer,
+                                                   uint32_t size,
+                                                   uint32_t mode);
+
+  /**
+   * Set a down channel to use the given buffer.
+   */
+  void
+  cortexm_architecture_trace_configure_down_channel (uint32_t channel,
+                                                     const char* name,
+                                                     void* buffer,
+                                                     uint32_t size);
+
+  /**
+   * Copy the bytes to an up channel; callable from threads and
+   * handlers. Returns the number of bytes written, which depends on
+   * the channel mode when the ring is full.
+   */
+  size_t
+  cortexm_architecture_trace_write (uint32_t channel, const void* buffer,
+                                    size_t size);
+
+  /**
+   * Write a zero terminated string to the up channel 0.
+   */
+  size_t
+  cortexm_architecture_trace_puts (const char* string);
+
+  /**
+   * Copy up to size bytes sent by the host on a down channel.
+   * Returns the number of bytes read, possibly 0.
+   */
+  size_t
+  cortexm_architecture_trace_read (uint32_t channel, void* buffer,
+                                   size_t size);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::trace
+{
+  // --------------------------------------------------------------------------
+  // Trace in C++.
+
+  /**
+   * Prepare the control block.
+   */
+  void
+  initialize (void);
+
+  /**
+   * Copy the bytes to an up channel.
+   */
+  size_t
+  write (uint32_t channel, const void* buffer, size_t size);
+
+  /**
+   * Write a zero terminated string to the up channel 0.
+   */
+  size_t
+  puts (const char* string);
+
+  /**
+   * Copy the bytes sent by the host on a down channel.
+   */
+  size_t
+  read (uint32_t channel, void* buffer, size_t size);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::trace
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_TRACE_H_
+
+// ----------------------------------------------------------------------------
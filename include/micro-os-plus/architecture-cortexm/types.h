@@ -22,8 +22,15 @@ extern "C"
 {
 #endif // defined(__cplusplus)
 
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+  // On the build machine the registers are as wide as the pointers,
+  // for example the semihosting parameter blocks must hold addresses.
+  typedef uintptr_t cortexm_architecture_register_t;
+  typedef intptr_t cortexm_architecture_signed_register_t;
+#else
   typedef uint32_t cortexm_architecture_register_t;
   typedef int32_t cortexm_architecture_signed_register_t;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
 
   typedef cortexm_architecture_register_t
       micro_os_plus_architecture_register_t;
@@ -0,0 +1,134 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <assert.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_VTOR)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_vectors_handler_t
+  cortexm_architecture_vectors_set_handler (
+      int32_t irq, cortexm_architecture_vectors_handler_t handler)
+  {
+    // The RAM table has no room beyond.
+    assert (irq >= -16 && irq < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS);
+
+    volatile cortexm_architecture_vectors_handler_t* vectors
+        = (volatile cortexm_architecture_vectors_handler_t*)
+            CORTEXM_ARCHITECTURE_SCB_VTOR;
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+    // Measured; the dispatcher calls the handler.
+    if (vectors[16 + irq] == cortexm_architecture_irq_statistics_dispatch)
+      {
+        vectors = cortexm_architecture_irq_statistics_handlers;
+      }
+#endif
+
+    cortexm_architecture_vectors_handler_t previous = vectors[16 + irq];
+    vectors[16 + irq] = handler;
+    // The vector fetch of an exception taken after this point sees
+    // the new handler.
+    cortexm_architecture_dsb ();
+    cortexm_architecture_isb ();
+
+    return previous;
+  }
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_vectors_handler_t
+  cortexm_architecture_vectors_get_handler (int32_t irq)
+  {
+    assert (irq >= -16 && irq < MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS);
+
+    volatile cortexm_architecture_vectors_handler_t* vectors
+        = (volatile cortexm_architecture_vectors_handler_t*)
+            CORTEXM_ARCHITECTURE_SCB_VTOR;
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS) \
+    && defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+    if (vectors[16 + irq] == cortexm_architecture_irq_statistics_dispatch)
+      {
+        return cortexm_architecture_irq_statistics_handlers[16 + irq];
+      }
+#endif
+
+    return vectors[16 + irq];
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::vectors
+{
+  // --------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  inline __attribute__ ((always_inline)) void
+  relocate (void)
+  {
+    cortexm_architecture_vectors_relocate ();
+  }
+
+  inline __attribute__ ((always_inline)) handler_t
+  set_handler (int32_t irq, handler_t handler)
+  {
+    return cortexm_architecture_vectors_set_handler (irq, handler);
+  }
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  inline __attribute__ ((always_inline)) handler_t
+  handler (int32_t irq)
+  {
+    return cortexm_architecture_vectors_get_handler (irq);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::vectors
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_VTOR)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/defines.h>
+#include <micro-os-plus/architecture-cortexm/nvic.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// The vector table in RAM.
+//
+// With MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS, a table with room for
+// the system exceptions and MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS
+// interrupts is reserved in the `.ram_vectors` section; the startup
+// copies `.interrupt_vectors` there and points VTOR to it, after which
+// the handlers can be changed at run time, and the vectors are
+// fetched from RAM, without the flash wait states.
+//
+// The IRQ numbers are those of CMSIS, as in `nvic.h`.
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS) \
+    && !defined(CORTEXM_ARCHITECTURE_HAS_VTOR)
+#error "The vector table cannot be moved on ARMv6-M"
+#endif
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_VTOR)
+
+// The number of entries, including the initial stack pointer.
+#define CORTEXM_ARCHITECTURE_VECTORS_COUNT \
+  (16 + MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS)
+
+// VTOR requires the table aligned to its size rounded up to a power
+// of 2, and to at least 128 bytes.
+#define CORTEXM_ARCHITECTURE_VECTORS_ALIGNMENT                  \
+  ((CORTEXM_ARCHITECTURE_VECTORS_COUNT * 4) <= 128    ? 128    \
+   : (CORTEXM_ARCHITECTURE_VECTORS_COUNT * 4) <= 256  ? 256    \
+   : (CORTEXM_ARCHITECTURE_VECTORS_COUNT * 4) <= 512  ? 512    \
+   : (CORTEXM_ARCHITECTURE_VECTORS_COUNT * 4) <= 1024 ? 1024   \
+                                                      : 2048)
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  typedef void (*cortexm_architecture_vectors_handler_t) (void);
+
+  // --------------------------------------------------------------------------
+  // Vector table in C.
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  /**
+   * Copy `.interrupt_vectors` to `.ram_vectors` and point VTOR to it.
+   * Called by `cortexm_architecture_startup_initialize_vectors()`.
+   */
+  void
+  cortexm_architecture_vectors_relocate (void);
+
+  /**
+   * Install the handler of an interrupt or of a system exception, in
+   * the RAM table, which must have been relocated; the next exception
+   * uses it. Returns the previous handler. The IRQ must be below
+   * MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS (asserted).
+   */
+  static cortexm_architecture_vectors_handler_t
+  cortexm_architecture_vectors_set_handler (
+      int32_t irq, cortexm_architecture_vectors_handler_t handler);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  /**
+   * Get the handler of an interrupt or of a system exception, from
+   * the table pointed by VTOR. The IRQ must be below
+   * MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS (asserted).
+   */
+  static cortexm_architecture_vectors_handler_t
+  cortexm_architecture_vectors_get_handler (int32_t irq);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::vectors
+{
+  // --------------------------------------------------------------------------
+  // Vector table in C++.
+
+  using handler_t = cortexm_architecture_vectors_handler_t;
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+  /**
+   * Copy the vector table to RAM and point VTOR to it.
+   */
+  void
+  relocate (void);
+
+  /**
+   * Install a handler; returns the previous one.
+   */
+  handler_t
+  set_handler (int32_t irq, handler_t handler);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+  /**
+   * Get the current handler.
+   */
+  handler_t
+  handler (int32_t irq);
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::vectors
+
+#endif // defined(__cplusplus)
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_VTOR)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_CORTEXM_VECTORS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,211 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_ATOMIC_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_ATOMIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#include <type_traits>
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the synthetic POSIX atomic operations,
+// with the compiler builtins; sequentially consistent, since on the
+// build machine the threads may run on several cores.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) bool
+  cortexm_architecture_atomic_compare_exchange (volatile uint32_t* object,
+                                                uint32_t* expected,
+                                                uint32_t desired)
+  {
+    return __atomic_compare_exchange_n (object, expected, desired, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_exchange (volatile uint32_t* object,
+                                        uint32_t value)
+  {
+    return __atomic_exchange_n (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    return __atomic_fetch_add (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    return __atomic_fetch_sub (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                        uint32_t value)
+  {
+    return __atomic_fetch_or (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                         uint32_t value)
+  {
+    return __atomic_fetch_and (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) bool
+  micro_os_plus_architecture_atomic_compare_exchange (
+      volatile uint32_t* object, uint32_t* expected, uint32_t desired)
+  {
+    return cortexm_architecture_atomic_compare_exchange (object, expected,
+                                                         desired);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_exchange (volatile uint32_t* object,
+                                              uint32_t value)
+  {
+    return cortexm_architecture_atomic_exchange (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_add (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_add (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_sub (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_sub (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_or (volatile uint32_t* object,
+                                              uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_or (object, value);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  micro_os_plus_architecture_atomic_fetch_and (volatile uint32_t* object,
+                                               uint32_t value)
+  {
+    return cortexm_architecture_atomic_fetch_and (object, value);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::atomic
+{
+  // --------------------------------------------------------------------------
+
+  template <typename T, typename F>
+  inline __attribute__ ((always_inline)) T
+  update (volatile T* object, F operation)
+  {
+    static_assert (std::is_integral_v<T>
+                       && (sizeof (T) == 1 || sizeof (T) == 2
+                           || sizeof (T) == 4),
+                   "Only 8, 16 and 32-bit integers");
+
+    T previous = __atomic_load_n (object, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n (object, &previous,
+                                         operation (previous), false,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+      {
+        ;
+      }
+    return previous;
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) bool
+  compare_exchange (volatile T* object, T& expected, T desired)
+  {
+    return __atomic_compare_exchange_n (object, &expected, desired, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  exchange (volatile T* object, T value)
+  {
+    return __atomic_exchange_n (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_add (volatile T* object, T value)
+  {
+    return __atomic_fetch_add (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_sub (volatile T* object, T value)
+  {
+    return __atomic_fetch_sub (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_or (volatile T* object, T value)
+  {
+    return __atomic_fetch_or (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  template <typename T>
+  inline __attribute__ ((always_inline)) T
+  fetch_and (volatile T* object, T value)
+  {
+    return __atomic_fetch_and (object, value, __ATOMIC_SEQ_CST);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::atomic
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_ATOMIC_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_DECLARATIONS_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_DECLARATIONS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/semihosting.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Declarations of the functions that emulate the Cortex-M instructions
+// on the build machine. Not inlined, to keep the system headers out
+// of the application.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Emulate `bkpt` by raising SIGTRAP, which stops a debugger.
+   */
+  void
+  micro_os_plus_architecture_synthetic_posix_bkpt (void);
+
+  /**
+   * Emulate `wfi` by waiting on a futex until a wake-up is posted.
+   * If a wake-up was posted since the previous call, return at once,
+   * as `wfi` does with a pending interrupt.
+   */
+  void
+  micro_os_plus_architecture_synthetic_posix_wfi (void);
+
+  /**
+   * Post a wake-up (the equivalent of an interrupt) to `wfi`.
+   * Async-signal-safe, it can be called from signal handlers and
+   * from other threads.
+   */
+  void
+  micro_os_plus_architecture_synthetic_posix_wakeup (void);
+
+  /**
+   * Get the emulated PRIMASK of the calling thread (1 if the
+   * asynchronous signals are blocked).
+   */
+  uint32_t
+  micro_os_plus_architecture_synthetic_posix_get_primask (void);
+
+  /**
+   * Set the emulated PRIMASK of the calling thread; 1 blocks the
+   * asynchronous signals, 0 unblocks them. The system call is issued
+   * only when the value changes.
+   */
+  void
+  micro_os_plus_architecture_synthetic_posix_set_primask (uint32_t value);
+
+  /**
+   * Execute a semihosting operation with host system calls.
+   */
+  micro_os_plus_semihosting_response_t
+  micro_os_plus_architecture_synthetic_posix_semihosting (
+      int reason, micro_os_plus_semihosting_param_block_t* arg);
+
+  /**
+   * Read the host timestamp counter.
+   */
+  uint64_t
+  micro_os_plus_architecture_synthetic_posix_cycles (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_DECLARATIONS_H_
+
+// ----------------------------------------------------------------------------
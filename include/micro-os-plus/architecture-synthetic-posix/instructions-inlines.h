@@ -0,0 +1,199 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INSTRUCTIONS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INSTRUCTIONS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-synthetic-posix/declarations.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the synthetic POSIX architecture instructions.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_nop (void)
+  {
+    __asm__ volatile(
+
+        " nop "
+
+        : /* Outputs */
+        : /* Inputs */
+        : /* Clobbers */
+    );
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_bkpt (void)
+  {
+    micro_os_plus_architecture_synthetic_posix_bkpt ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_wfi (void)
+  {
+    micro_os_plus_architecture_synthetic_posix_wfi ();
+  }
+
+  // The posted wake-ups are the events.
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_wfe (void)
+  {
+    micro_os_plus_architecture_synthetic_posix_wfi ();
+  }
+
+  // On the build machine the barriers are full fences, since the
+  // threads may run on several cores.
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_dmb (void)
+  {
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_dsb (void)
+  {
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_isb (void)
+  {
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_nop (void)
+  {
+    cortexm_architecture_nop ();
+  }
+
+  /**
+   * `break` instruction.
+   */
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_brk (void)
+  {
+    cortexm_architecture_bkpt ();
+  }
+
+  /**
+   * `wfi` instruction.
+   */
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_wfi (void)
+  {
+    cortexm_architecture_wfi ();
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  nop (void)
+  {
+    cortexm_architecture_nop ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  bkpt (void)
+  {
+    cortexm_architecture_bkpt ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  wfi (void)
+  {
+    cortexm_architecture_wfi ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  wfe (void)
+  {
+    cortexm_architecture_wfe ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dmb (void)
+  {
+    cortexm_architecture_dmb ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  dsb (void)
+  {
+    cortexm_architecture_dsb ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  isb (void)
+  {
+    cortexm_architecture_isb ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture
+
+namespace micro_os_plus::architecture
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  nop (void)
+  {
+    cortexm::architecture::nop ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  brk (void)
+  {
+    cortexm::architecture::bkpt ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  wfi (void)
+  {
+    cortexm::architecture::wfi ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INSTRUCTIONS_INLINES_H_
+
+// ----------------------------------------------------------------------------
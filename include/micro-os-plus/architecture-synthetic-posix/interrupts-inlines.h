@@ -0,0 +1,228 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INTERRUPTS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INTERRUPTS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-synthetic-posix/declarations.h>
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the synthetic POSIX interrupts masking;
+// the signals play the role of the interrupts, and PRIMASK blocks
+// them in the calling thread.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_disable (void)
+  {
+    micro_os_plus_architecture_synthetic_posix_set_primask (1);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_enable (void)
+  {
+    micro_os_plus_architecture_synthetic_posix_set_primask (0);
+  }
+
+  static inline __attribute__ ((always_inline)) uint32_t
+  cortexm_architecture_interrupts_get_primask (void)
+  {
+    return micro_os_plus_architecture_synthetic_posix_get_primask ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_set_primask (uint32_t value)
+  {
+    micro_os_plus_architecture_synthetic_posix_set_primask (value);
+  }
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_critical_section_enter (void)
+  {
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_disable ();
+
+    return status;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_critical_section_exit (
+      cortexm_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_set_primask (status);
+  }
+
+  static inline __attribute__ ((always_inline))
+  cortexm_architecture_interrupts_status_t
+  cortexm_architecture_interrupts_uncritical_section_enter (void)
+  {
+    cortexm_architecture_interrupts_status_t status
+        = cortexm_architecture_interrupts_get_primask ();
+    cortexm_architecture_interrupts_enable ();
+
+    return status;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_interrupts_uncritical_section_exit (
+      cortexm_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_set_primask (status);
+  }
+
+  // --------------------------------------------------------------------------
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_disable (void)
+  {
+    cortexm_architecture_interrupts_disable ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_enable (void)
+  {
+    cortexm_architecture_interrupts_enable ();
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_critical_section_enter (void)
+  {
+    return cortexm_architecture_interrupts_critical_section_enter ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_critical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_critical_section_exit (status);
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_architecture_interrupts_status_t
+  micro_os_plus_architecture_interrupts_uncritical_section_enter (void)
+  {
+    return cortexm_architecture_interrupts_uncritical_section_enter ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_interrupts_uncritical_section_exit (
+      micro_os_plus_architecture_interrupts_status_t status)
+  {
+    cortexm_architecture_interrupts_uncritical_section_exit (status);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    cortexm_architecture_interrupts_disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    cortexm_architecture_interrupts_enable ();
+  }
+
+  inline __attribute__ ((always_inline)) uint32_t
+  primask (void)
+  {
+    return cortexm_architecture_interrupts_get_primask ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  primask (uint32_t value)
+  {
+    cortexm_architecture_interrupts_set_primask (value);
+  }
+
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) critical_section::critical_section ()
+      : status_{ cortexm_architecture_interrupts_critical_section_enter () }
+  {
+  }
+
+  inline __attribute__ ((always_inline)) critical_section::~critical_section ()
+  {
+    cortexm_architecture_interrupts_critical_section_exit (status_);
+  }
+
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline))
+  uncritical_section::uncritical_section ()
+      : status_{ cortexm_architecture_interrupts_uncritical_section_enter () }
+  {
+  }
+
+  inline __attribute__ ((always_inline))
+  uncritical_section::~uncritical_section ()
+  {
+    cortexm_architecture_interrupts_uncritical_section_exit (status_);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::interrupts
+
+namespace micro_os_plus::architecture::interrupts
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) void
+  disable (void)
+  {
+    cortexm::architecture::interrupts::disable ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  enable (void)
+  {
+    cortexm::architecture::interrupts::enable ();
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::interrupts
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_INTERRUPTS_INLINES_H_
+
+// ----------------------------------------------------------------------------
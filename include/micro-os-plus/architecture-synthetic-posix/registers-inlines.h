@@ -0,0 +1,165 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_REGISTERS_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_REGISTERS_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the synthetic POSIX architecture registers.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * There is a single stack on the host; the frame address of the
+   * caller is a good enough approximation of the stack pointer.
+   */
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_msp (void)
+  {
+    return (cortexm_architecture_register_t)__builtin_frame_address (0);
+  }
+
+  /**
+   * The host stack is managed by the operating system; changing it
+   * has no effect.
+   */
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_msp (
+      cortexm_architecture_register_t top_of_main_stack)
+  {
+    (void)top_of_main_stack;
+  }
+
+  /**
+   * The threads run on the same host stack.
+   */
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_psp (void)
+  {
+    return (cortexm_architecture_register_t)__builtin_frame_address (0);
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_psp (
+      cortexm_architecture_register_t top_of_process_stack)
+  {
+    (void)top_of_process_stack;
+  }
+
+  /**
+   * Privileged, on the main stack.
+   */
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_control (void)
+  {
+    return 0;
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  cortexm_architecture_set_control (cortexm_architecture_register_t value)
+  {
+    (void)value;
+  }
+
+  /**
+   * Always in thread mode; the signal handlers are not identified.
+   */
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_ipsr (void)
+  {
+    return 0;
+  }
+
+  static inline __attribute__ ((always_inline)) cortexm_architecture_register_t
+  cortexm_architecture_get_xpsr (void)
+  {
+    return 0;
+  }
+
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_architecture_register_t
+  micro_os_plus_architecture_get_sp (void)
+  {
+    return cortexm_architecture_get_msp ();
+  }
+
+  static inline __attribute__ ((always_inline)) void
+  micro_os_plus_architecture_set_sp (
+      micro_os_plus_architecture_register_t top_of_stack)
+  {
+    cortexm_architecture_set_msp (top_of_stack);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ============================================================================
+
+#if defined(__cplusplus)
+
+namespace cortexm::architecture::registers
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) register_t
+  msp (void)
+  {
+    return cortexm_architecture_get_msp ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  msp (register_t top_of_main_stack)
+  {
+    cortexm_architecture_set_msp (top_of_main_stack);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace cortexm::architecture::registers
+
+namespace micro_os_plus::architecture::registers
+{
+  // --------------------------------------------------------------------------
+
+  inline __attribute__ ((always_inline)) register_t
+  sp (void)
+  {
+    return micro_os_plus_architecture_get_sp ();
+  }
+
+  inline __attribute__ ((always_inline)) void
+  sp (register_t top_of_stack)
+  {
+    micro_os_plus_architecture_set_sp (top_of_stack);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::architecture::registers
+
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_REGISTERS_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_SEMIHOSTING_INLINES_H_
+#define MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_SEMIHOSTING_INLINES_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture-cortexm/semihosting.h>
+#include <micro-os-plus/architecture-synthetic-posix/declarations.h>
+
+// ----------------------------------------------------------------------------
+// Inline implementations for the synthetic POSIX semihosting call.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * There is no debugger to trap into; the operations are
+   * performed directly with host system calls.
+   */
+  static inline __attribute__ ((always_inline))
+  micro_os_plus_semihosting_response_t
+  micro_os_plus_semihosting_call_host (
+      int reason, micro_os_plus_semihosting_param_block_t* arg)
+  {
+    return micro_os_plus_architecture_synthetic_posix_semihosting (reason,
+                                                                    arg);
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX_SEMIHOSTING_INLINES_H_
+
+// ----------------------------------------------------------------------------
@@ -21,12 +21,70 @@
 // #include <micro-os-plus/architecture-cortexm/declarations.h>
 
 #include <micro-os-plus/architecture-cortexm/instructions.h>
-#include <micro-os-plus/architecture-cortexm/instructions-inlines.h>
-
 #include <micro-os-plus/architecture-cortexm/registers.h>
-#include <micro-os-plus/architecture-cortexm/registers-inlines.h>
+#include <micro-os-plus/architecture-cortexm/semihosting.h>
+#include <micro-os-plus/architecture-cortexm/cycles.h>
+#include <micro-os-plus/architecture-cortexm/interrupts.h>
+#include <micro-os-plus/architecture-cortexm/atomic.h>
+#include <micro-os-plus/architecture-cortexm/ring-buffer.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-file.h>
+#include <micro-os-plus/architecture-cortexm/irq-statistics.h>
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+
+// The same entry points, implemented on the build machine.
+#include <micro-os-plus/architecture-synthetic-posix/declarations.h>
+
+#include <micro-os-plus/architecture-synthetic-posix/instructions-inlines.h>
+#include <micro-os-plus/architecture-synthetic-posix/registers-inlines.h>
+#include <micro-os-plus/architecture-synthetic-posix/semihosting-inlines.h>
+#include <micro-os-plus/architecture-synthetic-posix/cycles-inlines.h>
+#include <micro-os-plus/architecture-synthetic-posix/interrupts-inlines.h>
+#include <micro-os-plus/architecture-synthetic-posix/atomic-inlines.h>
 
+#else
+
+// Cortex-M only.
+#include <micro-os-plus/architecture-cortexm/startup.h>
+#include <micro-os-plus/architecture-cortexm/function-profile.h>
+#include <micro-os-plus/architecture-cortexm/context.h>
+#include <micro-os-plus/architecture-cortexm/stack.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-output.h>
+#include <micro-os-plus/architecture-cortexm/trace.h>
+#include <micro-os-plus/architecture-cortexm/crash-record.h>
+#include <micro-os-plus/architecture-cortexm/fault.h>
+#include <micro-os-plus/architecture-cortexm/cache.h>
+#include <micro-os-plus/architecture-cortexm/mpu.h>
+#include <micro-os-plus/architecture-cortexm/nvic.h>
+#include <micro-os-plus/architecture-cortexm/vectors.h>
+#include <micro-os-plus/architecture-cortexm/tickless.h>
+
+#include <micro-os-plus/architecture-cortexm/instructions-inlines.h>
+#include <micro-os-plus/architecture-cortexm/registers-inlines.h>
 #include <micro-os-plus/architecture-cortexm/semihosting-inlines.h>
+#include <micro-os-plus/architecture-cortexm/cycles-inlines.h>
+#include <micro-os-plus/architecture-cortexm/interrupts-inlines.h>
+#include <micro-os-plus/architecture-cortexm/atomic-inlines.h>
+#include <micro-os-plus/architecture-cortexm/startup-inlines.h>
+#include <micro-os-plus/architecture-cortexm/function-profile-inlines.h>
+#include <micro-os-plus/architecture-cortexm/context-inlines.h>
+#include <micro-os-plus/architecture-cortexm/stack-inlines.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-output-inlines.h>
+#include <micro-os-plus/architecture-cortexm/trace-inlines.h>
+#include <micro-os-plus/architecture-cortexm/crash-record-inlines.h>
+#include <micro-os-plus/architecture-cortexm/fault-inlines.h>
+#include <micro-os-plus/architecture-cortexm/cache-inlines.h>
+#include <micro-os-plus/architecture-cortexm/mpu-inlines.h>
+#include <micro-os-plus/architecture-cortexm/nvic-inlines.h>
+#include <micro-os-plus/architecture-cortexm/vectors-inlines.h>
+#include <micro-os-plus/architecture-cortexm/tickless-inlines.h>
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+
+// Common, built on the above.
+#include <micro-os-plus/architecture-cortexm/ring-buffer-inlines.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-file-inlines.h>
+#include <micro-os-plus/architecture-cortexm/irq-statistics-inlines.h>
 
 // ----------------------------------------------------------------------------
 
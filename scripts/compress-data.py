@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Compress the .data initialisation images of a Cortex-M ELF file.
+
+A post-link step; for each record in the `.mem_inits` data array
+(from, region_begin, region_end), the image at `from` is replaced by
+an LZ4 block, and bit 0 of `from` is set to tell the startup engine
+(`cortexm_architecture_startup_initialize_data()`) to decompress it.
+
+Records already compressed, loaded in place (RAM only layouts), or
+which do not shrink, are left as they are.
+
+When the image is alone in its program segment (the usual
+`>RAM AT>FLASH` case), the segment and its section are reduced to the
+compressed size, and the images which follow it, up to the first
+section which runs from flash, are moved down over the freed space,
+with their records updated; with sections-flash.ld these are the
+.data and .dtcm_data images, at the end of the flash, so the flash
+content is shorter, as is the binary written with `--binary`.
+Images followed by code (.fast_text) keep their place, and the rest
+of their space is left unused.
+
+The stream uses the LZ4 block format (token, literals, 16-bit offset,
+match); the end of block restrictions of the reference decoder are
+not needed, the decoder stops when the region is full.
+"""
+
+import argparse
+import struct
+import sys
+
+from elf32 import Elf32, PT_LOAD
+
+# Must match CORTEXM_ARCHITECTURE_STARTUP_DATA_COMPRESSED in startup.h.
+DATA_COMPRESSED = 0x1
+
+MIN_MATCH = 4
+MAX_OFFSET = 0xFFFF
+
+# -----------------------------------------------------------------------------
+
+
+def _put_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _put_sequence(out, literals, offset=0, match_length=0):
+    literal_length = len(literals)
+    token = min(literal_length, 15) << 4
+    if match_length:
+        token |= min(match_length - MIN_MATCH, 15)
+    out.append(token)
+    if literal_length >= 15:
+        _put_length(out, literal_length - 15)
+    out += literals
+    if match_length:
+        out += struct.pack('<H', offset)
+        if match_length - MIN_MATCH >= 15:
+            _put_length(out, match_length - MIN_MATCH - 15)
+
+
+def lz4_compress(data):
+    """Greedy LZ4 block compression, with the last position of each
+    4-byte sequence; overlapping matches encode the runs."""
+    out = bytearray()
+    size = len(data)
+    last = {}
+    anchor = 0
+    i = 0
+    while i + MIN_MATCH <= size:
+        key = bytes(data[i:i + MIN_MATCH])
+        candidate = last.get(key)
+        last[key] = i
+        if candidate is None or i - candidate > MAX_OFFSET:
+            i += 1
+            continue
+
+        length = MIN_MATCH
+        while i + length < size and data[candidate + length] == data[i + length]:
+            length += 1
+
+        _put_sequence(out, data[anchor:i], i - candidate, length)
+        for j in range(i + 1, min(i + length, size - MIN_MATCH + 1)):
+            last[bytes(data[j:j + MIN_MATCH])] = j
+        i += length
+        anchor = i
+
+    if anchor < size:
+        _put_sequence(out, data[anchor:])
+    return bytes(out)
+
+
+def lz4_decompress(stream, size):
+    """The same algorithm as the startup engine, to check the result."""
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        token = stream[i]
+        i += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                byte = stream[i]
+                i += 1
+                length += byte
+                if byte != 255:
+                    break
+        out += stream[i:i + length]
+        i += length
+        if len(out) >= size:
+            break
+        offset = stream[i] | (stream[i + 1] << 8)
+        i += 2
+        length = (token & 0x0F) + MIN_MATCH
+        if token & 0x0F == 15:
+            while True:
+                byte = stream[i]
+                i += 1
+                length += byte
+                if byte != 255:
+                    break
+        for _ in range(length):
+            out.append(out[-offset])
+    return bytes(out)
+
+# -----------------------------------------------------------------------------
+
+
+def _image_section(elf, image_offset, region_begin):
+    for index, section in enumerate(elf.sections()):
+        if section[3] == region_begin and section[4] == image_offset:
+            return elf.shoff + index * elf.shentsize
+    return None
+
+
+def compress_records(elf, verbose):
+    """Compress the images, then pack those alone in their segments;
+    returns the number of flash bytes saved."""
+    begin = elf.symbol('__data_regions_array_begin__')
+    end = elf.symbol('__data_regions_array_end__')
+
+    # The segments which hold only a copied image, by their address.
+    images = {}
+
+    for record in range(begin, end, 12):
+        record_offset = elf.file_offset(record, physical=False)
+        (load, region_begin, region_end) = struct.unpack_from(
+            '<III', elf.content, record_offset)
+        size = region_end - region_begin
+
+        if load & DATA_COMPRESSED or load == region_begin or size == 0:
+            continue
+
+        image_offset = elf.file_offset(load, physical=True)
+        segment = None
+        for offset, (p_type, _, p_vaddr, p_paddr, p_filesz, *_) \
+                in elf.segments():
+            if p_type == PT_LOAD and p_paddr == load \
+                    and p_vaddr == region_begin and p_filesz == size:
+                segment = offset
+        images[load] = (record_offset, segment, size)
+
+        image = elf.content[image_offset:image_offset + size]
+        stream = lz4_compress(image)
+        if len(stream) >= size:
+            if verbose:
+                print(f'0x{region_begin:08X}: {size} bytes, not compressed')
+            continue
+        assert lz4_decompress(stream, size) == image
+
+        elf.content[image_offset:image_offset + size] = \
+            stream + b'\xFF' * (size - len(stream))
+        struct.pack_into('<I', elf.content, record_offset,
+                         load | DATA_COMPRESSED)
+
+        if segment is not None:
+            # Also the memory size, otherwise the loaders may clear
+            # the flash after the file content.
+            filesz = (len(stream) + 3) & ~3
+            struct.pack_into('<II', elf.content, segment + 16, filesz,
+                             filesz)
+            # For the tools which place the sections by segment, it
+            # must fit in it.
+            section = _image_section(elf, image_offset, region_begin)
+            if section is not None:
+                struct.pack_into('<I', elf.content, section + 20, filesz)
+
+        if verbose:
+            print(f'0x{region_begin:08X}: {size} -> {len(stream)} bytes')
+
+    return _pack_images(elf, images, verbose)
+
+
+def _pack_images(elf, images, verbose):
+    """Move the images down over the space freed before them; the
+    space freed before a segment which is not a movable image remains
+    unused. Returns the space freed at the end."""
+    loads = sorted((p_paddr, offset, p_filesz)
+                   for offset, (p_type, _, _, p_paddr, p_filesz, *_)
+                   in elf.segments() if p_type == PT_LOAD and p_filesz)
+
+    freed = 0
+    for (paddr, offset, filesz) in loads:
+        image = images.get(paddr)
+        if image is None or image[1] != offset:
+            freed = 0
+            continue
+
+        (record_offset, _, size) = image
+        if freed:
+            struct.pack_into('<I', elf.content, offset + 12, paddr - freed)
+            (load,) = struct.unpack_from('<I', elf.content, record_offset)
+            struct.pack_into('<I', elf.content, record_offset, load - freed)
+            if verbose:
+                print(f'0x{paddr:08X}: moved to 0x{paddr - freed:08X}')
+        freed += size - filesz
+
+    return freed
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compress the .mem_inits .data images of an ELF file.')
+    parser.add_argument('elf', help='the file to process, in place')
+    parser.add_argument('-o', '--output', help='write to another ELF file')
+    parser.add_argument('--binary', help='also write a binary image')
+    parser.add_argument('-v', '--verbose', action='store_true')
+    args = parser.parse_args()
+
+    with open(args.elf, 'rb') as file:
+        elf = Elf32(file.read())
+
+    saved = compress_records(elf, args.verbose)
+    if args.verbose:
+        print(f'{saved} bytes of flash saved')
+
+    with open(args.output or args.elf, 'wb') as file:
+        file.write(elf.content)
+    if args.binary:
+        with open(args.binary, 'wb') as file:
+            file.write(elf.binary())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
+
+# -----------------------------------------------------------------------------
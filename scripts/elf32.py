@@ -0,0 +1,100 @@
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Just enough of a little endian ELF32 reader/writer, for the
+Cortex-M post-link scripts; no external dependencies.
+"""
+
+import struct
+
+PT_LOAD = 1
+SHT_SYMTAB = 2
+STT_FUNC = 2
+EM_ARM = 40
+
+# -----------------------------------------------------------------------------
+
+
+class Elf32:
+    """An ELF32 file, kept in memory; changes are made in place."""
+
+    def __init__(self, content):
+        self.content = bytearray(content)
+        if self.content[:4] != b'\x7fELF' or self.content[4] != 1 \
+                or self.content[5] != 1:
+            raise ValueError('not a little endian ELF32 file')
+
+        (machine,) = struct.unpack_from('<H', self.content, 18)
+        if machine != EM_ARM:
+            raise ValueError('not an Arm ELF file')
+
+        (self.phoff, self.shoff) = struct.unpack_from('<II', self.content, 28)
+        (self.phentsize, self.phnum, self.shentsize, self.shnum) = \
+            struct.unpack_from('<HHHH', self.content, 42)
+
+    def segments(self):
+        for index in range(self.phnum):
+            offset = self.phoff + index * self.phentsize
+            fields = struct.unpack_from('<8I', self.content, offset)
+            yield offset, fields
+
+    def sections(self):
+        for index in range(self.shnum):
+            offset = self.shoff + index * self.shentsize
+            yield struct.unpack_from('<10I', self.content, offset)
+
+    def symbols(self):
+        """Yield (name, value, size, type) for all .symtab entries."""
+        sections = list(self.sections())
+        for section in sections:
+            if section[1] != SHT_SYMTAB:
+                continue
+            strtab = sections[section[6]]
+            for offset in range(section[4], section[4] + section[5],
+                                section[9]):
+                (st_name, st_value, st_size, st_info) = struct.unpack_from(
+                    '<IIIB', self.content, offset)
+                begin = strtab[4] + st_name
+                end = self.content.index(b'\0', begin)
+                yield (self.content[begin:end].decode(), st_value, st_size,
+                       st_info & 0xF)
+
+    def symbol(self, name):
+        for (symbol_name, value, _, _) in self.symbols():
+            if symbol_name == name:
+                return value
+        raise KeyError(f'symbol {name} not found (stripped file?)')
+
+    def file_offset(self, address, physical):
+        for _, (p_type, p_offset, p_vaddr, p_paddr, p_filesz, *_) \
+                in self.segments():
+            base = p_paddr if physical else p_vaddr
+            if p_type == PT_LOAD and base <= address < base + p_filesz:
+                return p_offset + address - base
+        raise ValueError(f'address 0x{address:08X} not in a loaded segment')
+
+    def binary(self):
+        loads = [(p_paddr, p_offset, p_filesz)
+                 for _, (p_type, p_offset, _, p_paddr, p_filesz, *_)
+                 in self.segments() if p_type == PT_LOAD and p_filesz]
+        origin = min(paddr for paddr, _, _ in loads)
+        end = max(paddr + filesz for paddr, _, filesz in loads)
+        out = bytearray(b'\xFF' * (end - origin))
+        for paddr, offset, filesz in loads:
+            out[paddr - origin:paddr - origin + filesz] = \
+                self.content[offset:offset + filesz]
+        return bytes(out)
+
+# -----------------------------------------------------------------------------
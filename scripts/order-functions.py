@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Generate the hot function linker script fragments from a profile.
+
+The profile is a text file with one address per line, optionally
+followed by a count; other lines are ignored, so the console output
+of the target can be used as is. It can be either:
+
+- the `MICRO_OS_PLUS_PROFILE 0x<address> <count>` lines written by
+  `cortexm_architecture_function_profile_dump()`, with the application
+  compiled with `-finstrument-functions` and
+  MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS, or
+- DWT PC samples (one address per line), as exported by the debugger.
+
+The addresses are symbolized with the function symbols of the ELF
+file, and the functions are ordered by count. The first ones, up to
+`--fast-bytes`, go to `hot-fast-text.ld` (included in `.fast_text`,
+ITCM or RAM), the others to `hot-text.ld` (included at the beginning
+of `.text`). The application must be compiled with
+`-ffunction-sections`, since the fragments refer to the input sections
+named `.text.<symbol>`, or `.text.<prefix>.<symbol>` for the functions
+which GCC places by their own profile (`.text.hot.`, `.text.unlikely.`,
+`.text.startup.`).
+
+Write the fragments to a folder passed to the linker with `-L` before
+the `linker-scripts` folder, which has empty defaults.
+"""
+
+import argparse
+import bisect
+import re
+import sys
+
+from elf32 import Elf32, STT_FUNC
+
+SAMPLE = re.compile(r'(?:^|\s)(0x[0-9A-Fa-f]+)(?:\s+(\d+))?\s*$')
+
+# -----------------------------------------------------------------------------
+
+
+def read_functions(elf):
+    functions = {}
+    for (name, value, size, symbol_type) in elf.symbols():
+        if symbol_type == STT_FUNC and size > 0:
+            # Clear the Thumb bit.
+            functions[value & ~1] = (size, name)
+    return sorted((address, size, name)
+                  for address, (size, name) in functions.items())
+
+
+def read_counts(lines, functions):
+    addresses = [address for (address, _, _) in functions]
+    counts = {}
+    unknown = 0
+    for line in lines:
+        match = SAMPLE.search(line)
+        if not match:
+            continue
+        address = int(match.group(1), 16) & ~1
+        count = int(match.group(2) or 1)
+
+        index = bisect.bisect_right(addresses, address) - 1
+        if index < 0 or address >= addresses[index] + functions[index][1]:
+            unknown += count
+            continue
+        (_, size, name) = functions[index]
+        (previous, _) = counts.get(name, (0, size))
+        counts[name] = (previous + count, size)
+    return counts, unknown
+
+
+def write_fragment(path, names, header):
+    with open(path, 'w') as file:
+        file.write(f'/* {header} Generated by order-functions.py. */\n')
+        for name in names:
+            file.write(f'*(.text.{name} .text.*.{name})\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Order the hot functions first, from a profile.')
+    parser.add_argument('elf', help='the profiled ELF file')
+    parser.add_argument('profile', help='the profile, or - for stdin')
+    parser.add_argument('-o', '--output-folder', default='.',
+                        help='where to write the fragments')
+    parser.add_argument('--fast-bytes', type=int, default=0,
+                        help='the size reserved for the hottest functions '
+                        'in .fast_text (default 0)')
+    parser.add_argument('--min-count', type=int, default=1,
+                        help='ignore the functions with fewer calls/samples')
+    parser.add_argument('-v', '--verbose', action='store_true')
+    args = parser.parse_args()
+
+    with open(args.elf, 'rb') as file:
+        functions = read_functions(Elf32(file.read()))
+
+    if args.profile == '-':
+        counts, unknown = read_counts(sys.stdin, functions)
+    else:
+        with open(args.profile) as file:
+            counts, unknown = read_counts(file, functions)
+
+    hot = sorted(((count, size, name)
+                  for name, (count, size) in counts.items()
+                  if count >= args.min_count),
+                 key=lambda entry: (-entry[0], entry[2]))
+
+    fast = []
+    text = []
+    fast_bytes = 0
+    for (count, size, name) in hot:
+        # Thumb functions are 2-byte aligned, count 4 to be safe.
+        aligned_size = (size + 3) & ~3
+        if fast_bytes + aligned_size <= args.fast_bytes:
+            fast.append(name)
+            fast_bytes += aligned_size
+        else:
+            text.append(name)
+        if args.verbose:
+            print(f'{count:10} {size:6} {name}')
+
+    write_fragment(f'{args.output_folder}/hot-fast-text.ld', fast,
+                   'The hottest functions, in .fast_text.')
+    write_fragment(f'{args.output_folder}/hot-text.ld', text,
+                   'The hot functions, first in .text.')
+
+    print(f'{len(fast)} functions ({fast_bytes} bytes) in .fast_text, '
+          f'{len(text)} first in .text', end='')
+    print(f', {unknown} samples outside functions' if unknown else '')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
+
+# -----------------------------------------------------------------------------
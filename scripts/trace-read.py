@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Extract the memory mapped trace channels from a RAM image.
+
+The image is a raw copy of the target memory, starting at `--base`;
+for example saved by QEMU (`pmemsave 0x20000000 0x10000 ram.bin` in the
+monitor), by GDB (`dump binary memory ram.bin 0x20000000 0x20010000`)
+or by OpenOCD (`dump_image ram.bin 0x20000000 0x10000`).
+
+The control block (`cortexm_architecture_trace_control`) is found via
+the ELF symbol when `--elf` is given, otherwise by scanning the image
+for its identifier. The unread bytes of an up channel (between the
+read and the write offsets) are written to stdout.
+
+While the target runs, the same block is read by the debuggers with
+RTT support (for example OpenOCD `rtt setup` / `rtt start`).
+"""
+
+import argparse
+import struct
+import sys
+
+from elf32 import Elf32
+
+DEFAULT_ID = b'SEGGER RTT'
+
+# cortexm_architecture_trace_control_t: id[16], up_channels, down_channels.
+HEADER = struct.Struct('<16sii')
+# cortexm_architecture_trace_channel_t: name, buffer, size, write_offset,
+# read_offset, flags.
+CHANNEL = struct.Struct('<6I')
+
+MODES = {0: 'skip', 1: 'trim', 2: 'block'}
+
+# -----------------------------------------------------------------------------
+
+
+class Image:
+    """A RAM image, addressed with the target addresses."""
+
+    def __init__(self, content, base):
+        self.content = content
+        self.base = base
+
+    def contains(self, address, size=1):
+        return self.base <= address and \
+            address + size <= self.base + len(self.content)
+
+    def read(self, address, size):
+        if not self.contains(address, size):
+            raise ValueError(f'0x{address:08X}+{size} not in the image')
+        offset = address - self.base
+        return self.content[offset:offset + size]
+
+    def string(self, address, elf):
+        """A zero terminated string, from the image or from the ELF."""
+        if address == 0:
+            return ''
+        if self.contains(address):
+            offset = address - self.base
+            end = self.content.find(b'\0', offset)
+            return self.content[offset:end].decode(errors='replace')
+        if elf is not None:
+            try:
+                offset = elf.file_offset(address, physical=False)
+            except ValueError:
+                return '?'
+            end = elf.content.index(b'\0', offset)
+            return elf.content[offset:end].decode(errors='replace')
+        return '?'
+
+
+def find_control(image, elf, identifier):
+    if elf is not None:
+        return elf.symbol('cortexm_architecture_trace_control')
+    # The block is word aligned; the unaligned matches are other data,
+    # for example a copy of the string.
+    offset = image.content.find(identifier + b'\0')
+    while offset >= 0 and (image.base + offset) % 4:
+        offset = image.content.find(identifier + b'\0', offset + 1)
+    if offset < 0:
+        raise ValueError(f'identifier {identifier.decode()} not found')
+    return image.base + offset
+
+
+def read_channels(image, address):
+    (identifier, up_count, down_count) = HEADER.unpack(
+        image.read(address, HEADER.size))
+    address += HEADER.size
+    channels = []
+    for index in range(up_count + down_count):
+        channels.append(CHANNEL.unpack(image.read(address, CHANNEL.size)))
+        address += CHANNEL.size
+    return (identifier.rstrip(b'\0'), channels[:up_count],
+            channels[up_count:])
+
+
+def unread(image, channel):
+    (_, buffer, size, write_offset, read_offset, _) = channel
+    if size == 0 or write_offset >= size or read_offset >= size:
+        return b''
+    if write_offset >= read_offset:
+        return image.read(buffer + read_offset, write_offset - read_offset)
+    return image.read(buffer + read_offset, size - read_offset) + \
+        image.read(buffer, write_offset)
+
+# -----------------------------------------------------------------------------
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Extract the trace channels from a RAM image.')
+    parser.add_argument('image', help='the raw memory image')
+    parser.add_argument('--base', type=lambda value: int(value, 0),
+                        required=True, help='the address of the image')
+    parser.add_argument('--elf', help='the application, for the symbols')
+    parser.add_argument('--id', default=DEFAULT_ID.decode(),
+                        help='the identifier, without --elf')
+    parser.add_argument('-c', '--channel', type=int, default=0,
+                        help='the up channel to extract (default 0)')
+    parser.add_argument('-l', '--list', action='store_true',
+                        help='list the channels instead')
+    args = parser.parse_args()
+
+    with open(args.image, 'rb') as file:
+        image = Image(file.read(), args.base)
+    elf = None
+    if args.elf:
+        with open(args.elf, 'rb') as file:
+            elf = Elf32(file.read())
+
+    address = find_control(image, elf, args.id.encode())
+    (identifier, up, down) = read_channels(image, address)
+    if not identifier:
+        print(f'0x{address:08X}: not initialised', file=sys.stderr)
+        return 1
+
+    if args.list:
+        print(f'0x{address:08X}: {identifier.decode()}')
+        for (direction, channels) in (('up', up), ('down', down)):
+            for index, channel in enumerate(channels):
+                (name, buffer, size, write_offset, read_offset,
+                 flags) = channel
+                mode = MODES.get(flags & 3, '?') if direction == 'up' else ''
+                print(f'{direction} {index} "{image.string(name, elf)}" '
+                      f'0x{buffer:08X} size {size} '
+                      f'write {write_offset} read {read_offset} {mode}'
+                      .rstrip())
+        return 0
+
+    if args.channel >= len(up):
+        print(f'no up channel {args.channel}', file=sys.stderr)
+        return 1
+    sys.stdout.buffer.write(unread(image, up[args.channel]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CONTEXT_SWITCH)
+
+#include <micro-os-plus/architecture.h>
+
+// ----------------------------------------------------------------------------
+
+uint32_t*
+cortexm_architecture_context_select (uint32_t* stack_pointer);
+
+void __attribute__ ((naked))
+PendSV_Handler (void);
+
+void __attribute__ ((naked))
+SVC_Handler (void);
+
+// ----------------------------------------------------------------------------
+
+uint32_t*
+cortexm_architecture_context_initialize_stack (uint32_t* stack_top,
+                                               void (*entry) (void*),
+                                               void* argument,
+                                               void (*exit) (void))
+{
+  // The exception frames are 8 bytes aligned.
+  cortexm_architecture_context_exception_frame_t* frame
+      = (cortexm_architecture_context_exception_frame_t*)((uint32_t)stack_top
+                                                          & ~7UL)
+        - 1;
+
+  frame->r0 = (uint32_t)argument;
+  frame->r1 = 0;
+  frame->r2 = 0;
+  frame->r3 = 0;
+  frame->r12 = 0;
+  frame->lr = (uint32_t)exit;
+  frame->pc = (uint32_t)entry & ~1UL;
+  frame->xpsr = CORTEXM_ARCHITECTURE_XPSR_T;
+
+  cortexm_architecture_context_saved_t* saved
+      = (cortexm_architecture_context_saved_t*)frame - 1;
+
+  saved->r4 = 0;
+  saved->r5 = 0;
+  saved->r6 = 0;
+  saved->r7 = 0;
+  saved->r8 = 0;
+  saved->r9 = 0;
+  saved->r10 = 0;
+  saved->r11 = 0;
+  saved->exc_return = CORTEXM_ARCHITECTURE_CONTEXT_INITIAL_EXC_RETURN;
+
+  return (uint32_t*)saved;
+}
+
+void
+cortexm_architecture_context_start (uint32_t* stack_pointer)
+{
+  // Switch only after all other handlers complete.
+  CORTEXM_ARCHITECTURE_SCB_SHPR3 |= CORTEXM_ARCHITECTURE_SCB_SHPR3_PRI_PENDSV;
+
+#if defined(__ARM_ARCH_6M__)
+  // No VTOR on Cortex-M0; the main stack keeps what main() used.
+  __asm__ volatile(
+
+      " mov r0, %[sp] \n"
+      " cpsie i \n"
+      " dsb \n"
+      " isb \n"
+      " svc 0 \n"
+
+      : /* Outputs */
+      : [sp] "r"(stack_pointer) /* Inputs */
+      : "r0", "memory" /* Clobbers */
+  );
+#else
+  // The initial main stack pointer, from the first vector.
+  uint32_t main_stack_top = *(uint32_t*)CORTEXM_ARCHITECTURE_SCB_VTOR;
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+  // If main() used the FPU, the SVC would stack an extended frame on
+  // the main stack, which is reset below; start without an FP
+  // context, and drop any lazily reserved space, since the frame it
+  // points to is also discarded.
+  CORTEXM_ARCHITECTURE_FPU_FPCCR &= ~CORTEXM_ARCHITECTURE_FPU_FPCCR_LSPACT;
+  cortexm_architecture_set_control (cortexm_architecture_get_control ()
+                                    & ~CORTEXM_ARCHITECTURE_CONTROL_FPCA);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+
+  __asm__ volatile(
+
+      " mov r0, %[sp] \n"
+      " msr msp, %[msp] \n"
+      " cpsie i \n"
+      " dsb \n"
+      " isb \n"
+      " svc 0 \n"
+
+      : /* Outputs */
+      : [sp] "r"(stack_pointer), [msp] "r"(main_stack_top) /* Inputs */
+      : "r0", "memory" /* Clobbers */
+  );
+#endif // defined(__ARM_ARCH_6M__)
+
+  __builtin_unreachable ();
+}
+
+// ----------------------------------------------------------------------------
+
+// Called from PendSV; not static, to be reachable from the naked
+// handler.
+uint32_t*
+cortexm_architecture_context_select (uint32_t* stack_pointer)
+{
+  cortexm_architecture_interrupts_status_t status
+      = cortexm_architecture_interrupts_critical_section_enter ();
+
+  uint32_t* next = cortexm_architecture_context_switch_hook (stack_pointer);
+
+  cortexm_architecture_interrupts_critical_section_exit (status);
+
+  return next;
+}
+
+// The PendSV and SVC handlers save/restore the context in the layout
+// described in `context.h`.
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+void
+PendSV_Handler (void)
+{
+  __asm__ volatile(
+
+      " mrs r0, psp \n"
+      " isb \n"
+#if defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+      // Extended frame (EXC_RETURN bit 4 cleared), save s16-s31;
+      // this also completes the lazy stacking of s0-s15.
+      " tst lr, #0x10 \n"
+      " it eq \n"
+      " vstmdbeq r0!, {s16-s31} \n"
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+      " stmdb r0!, {r4-r11, lr} \n"
+
+      " bl cortexm_architecture_context_select \n"
+
+      " ldmia r0!, {r4-r11, lr} \n"
+#if defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+      " tst lr, #0x10 \n"
+      " it eq \n"
+      " vldmiaeq r0!, {s16-s31} \n"
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+      " msr psp, r0 \n"
+      " isb \n"
+      " bx lr \n"
+
+  );
+}
+
+void
+SVC_Handler (void)
+{
+  __asm__ volatile(
+
+      // The stack pointer passed in r0 to the svc.
+      " mrs r0, msp \n"
+      " ldr r0, [r0] \n"
+
+      " ldmia r0!, {r4-r11, lr} \n"
+      " msr psp, r0 \n"
+      " isb \n"
+      " bx lr \n"
+
+  );
+}
+
+#else
+
+// Without stmdb and with stm/ldm limited to r0-r7, r8-r11 and
+// EXC_RETURN are moved via r3-r7.
+
+void
+PendSV_Handler (void)
+{
+  __asm__ volatile(
+
+      " mrs r0, psp \n"
+      " subs r0, #36 \n"
+      " mov r1, r0 \n"
+      " stmia r1!, {r4-r7} \n"
+      " mov r3, r8 \n"
+      " mov r4, r9 \n"
+      " mov r5, r10 \n"
+      " mov r6, r11 \n"
+      " mov r7, lr \n"
+      " stmia r1!, {r3-r7} \n"
+
+      " bl cortexm_architecture_context_select \n"
+
+      " adds r0, #16 \n"
+      " ldmia r0!, {r3-r7} \n"
+      " mov r8, r3 \n"
+      " mov r9, r4 \n"
+      " mov r10, r5 \n"
+      " mov r11, r6 \n"
+      " mov lr, r7 \n"
+      " msr psp, r0 \n"
+      " subs r0, #36 \n"
+      " ldmia r0!, {r4-r7} \n"
+      " bx lr \n"
+
+  );
+}
+
+void
+SVC_Handler (void)
+{
+  __asm__ volatile(
+
+      " mrs r0, msp \n"
+      " ldr r0, [r0] \n"
+
+      " adds r0, #16 \n"
+      " ldmia r0!, {r3-r7} \n"
+      " mov r8, r3 \n"
+      " mov r9, r4 \n"
+      " mov r10, r5 \n"
+      " mov r11, r6 \n"
+      " mov lr, r7 \n"
+      " msr psp, r0 \n"
+      " subs r0, #36 \n"
+      " ldmia r0!, {r4-r7} \n"
+      " isb \n"
+      " bx lr \n"
+
+  );
+}
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CONTEXT_SWITCH)
+
+// ----------------------------------------------------------------------------
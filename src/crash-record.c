@@ -0,0 +1,213 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/exception-handlers.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stddef.h>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+// Not cleared by the startup, so it survives the reset.
+__attribute__ ((section (".noinit")))
+static cortexm_architecture_crash_record_t crash_record;
+
+// With the fault handlers, the record is saved when the application
+// does not resume the faulty context.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+static void __attribute__ ((naked))
+crash_record_fault_handler (void);
+
+void __attribute__ ((naked, alias ("crash_record_fault_handler")))
+HardFault_Handler (void);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+void __attribute__ ((naked, alias ("crash_record_fault_handler")))
+MemManage_Handler (void);
+void __attribute__ ((naked, alias ("crash_record_fault_handler")))
+BusFault_Handler (void);
+// With the stack limits, UsageFault_Handler is in src/stack-overflow.c,
+// and its default handlers save the record.
+#if !(defined(MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMITS) \
+      && (defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)))
+void __attribute__ ((naked, alias ("crash_record_fault_handler")))
+UsageFault_Handler (void);
+#endif
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+// ----------------------------------------------------------------------------
+
+// FNV-1a, over all words but the checksum.
+static uint32_t
+crash_record_checksum (const cortexm_architecture_crash_record_t* record)
+{
+  const uint32_t* words = (const uint32_t*)record;
+  uint32_t hash = 2166136261UL;
+  for (uint32_t i = 0;
+       i < offsetof (cortexm_architecture_crash_record_t, checksum) / 4; ++i)
+    {
+      hash ^= words[i];
+      hash *= 16777619UL;
+    }
+  return hash;
+}
+
+static bool
+crash_record_is_valid (void)
+{
+  return crash_record.magic == CORTEXM_ARCHITECTURE_CRASH_RECORD_MAGIC
+         && crash_record.checksum == crash_record_checksum (&crash_record);
+}
+
+// ----------------------------------------------------------------------------
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+// Pass the active stack pointer and EXC_RETURN; nothing is pushed
+// before, so the frame is exactly where the hardware left it.
+static void
+crash_record_fault_handler (void)
+{
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  __asm__ volatile(
+
+      " tst lr, #4 \n"
+      " ite eq \n"
+      " mrseq r0, msp \n"
+      " mrsne r0, psp \n"
+      " mov r1, lr \n"
+      " b cortexm_architecture_crash_record_save \n"
+
+  );
+#else
+  __asm__ volatile(
+
+      " mov r1, lr \n"
+      " movs r0, #4 \n"
+      " tst r0, r1 \n"
+      " bne 1f \n"
+      " mrs r0, msp \n"
+      " b 2f \n"
+      "1: \n"
+      " mrs r0, psp \n"
+      "2: \n"
+      // The target may be out of range of a 16-bit branch.
+      " ldr r2, =cortexm_architecture_crash_record_save \n"
+      " bx r2 \n"
+      " .ltorg \n"
+
+  );
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+}
+
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+void
+cortexm_architecture_crash_record_save (uint32_t* stack_pointer,
+                                        uint32_t exc_return)
+{
+  cortexm_architecture_crash_record_t* record = &crash_record;
+  uint32_t count = crash_record_is_valid () ? record->count + 1 : 1;
+
+  memset (record, 0, sizeof (*record));
+  record->magic = CORTEXM_ARCHITECTURE_CRASH_RECORD_MAGIC;
+  record->count = count;
+  record->exception = cortexm_architecture_get_ipsr ()
+                      & CORTEXM_ARCHITECTURE_IPSR_EXCEPTION_MASK;
+  record->exc_return = exc_return;
+  record->stack_pointer = (uint32_t)stack_pointer;
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  record->cfsr = CORTEXM_ARCHITECTURE_SCB_CFSR;
+  record->hfsr = CORTEXM_ARCHITECTURE_SCB_HFSR;
+  record->mmfar = CORTEXM_ARCHITECTURE_SCB_MMFAR;
+  record->bfar = CORTEXM_ARCHITECTURE_SCB_BFAR;
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  // A fault while reading a corrupted stack pointer would lock up
+  // the core; the main stack is [__stack - __stack_size, __stack), and
+  // the thread stacks are assumed to be between the beginning of the
+  // RAM and the main stack top.
+  uint32_t* top = &__stack;
+  uint32_t bottom;
+  if ((exc_return & CORTEXM_ARCHITECTURE_EXC_RETURN_SPSEL) == 0)
+    {
+      bottom = (uint32_t)&__stack - (uint32_t)&__stack_size;
+    }
+  else
+    {
+      bottom = (uint32_t)&__ram_begin__;
+    }
+  if (((uint32_t)stack_pointer & 3) == 0
+      && (uint32_t)stack_pointer >= bottom
+      && (uint32_t)stack_pointer + sizeof (record->frame) <= (uint32_t)top)
+    {
+      cortexm_architecture_fault_frame_t frame;
+      cortexm_architecture_fault_decode (&frame, stack_pointer, exc_return);
+
+      if ((uint32_t)(frame.basic + 1) <= (uint32_t)top)
+        {
+          memcpy (&record->frame, frame.basic, sizeof (record->frame));
+        }
+
+      uint32_t* p = frame.caller_stack_pointer;
+      for (uint32_t i = 0;
+           i < MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD_STACK_WORDS && p < top;
+           ++i)
+        {
+          record->stack[i] = *p++;
+        }
+    }
+
+  record->checksum = crash_record_checksum (record);
+
+  cortexm_architecture_dsb ();
+  CORTEXM_ARCHITECTURE_SCB_AIRCR = CORTEXM_ARCHITECTURE_SCB_AIRCR_VECTKEY
+                                   | CORTEXM_ARCHITECTURE_SCB_AIRCR_SYSRESETREQ;
+  cortexm_architecture_dsb ();
+
+  while (true)
+    {
+      // Wait for the reset.
+    }
+}
+
+bool
+cortexm_architecture_crash_record_retrieve (
+    cortexm_architecture_crash_record_t* record)
+{
+  bool valid = crash_record_is_valid ();
+  if (valid)
+    {
+      memcpy (record, &crash_record, sizeof (*record));
+    }
+
+  // Also clears the random content after a power-on.
+  crash_record.magic = 0;
+
+  return valid;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+// ----------------------------------------------------------------------------
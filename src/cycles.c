@@ -0,0 +1,172 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// ----------------------------------------------------------------------------
+
+// The high word of the 64-bit count and the last low word seen,
+// used to detect wraps.
+static uint32_t cycles_high;
+static uint32_t cycles_last;
+
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+// The 24-bit SysTick count extended to 32-bit, and the last
+// SysTick value seen.
+static uint32_t systick_count;
+static uint32_t systick_last;
+#endif // defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+
+// ----------------------------------------------------------------------------
+
+bool
+cortexm_architecture_cycles_enable (void)
+{
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+
+  if ((CORTEXM_ARCHITECTURE_SYST_CSR & CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE)
+      == 0)
+    {
+      // Not used by the application, start it free running from
+      // the core clock, with the maximum period and no interrupts.
+      CORTEXM_ARCHITECTURE_SYST_RVR = CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+      CORTEXM_ARCHITECTURE_SYST_CVR = 0;
+      CORTEXM_ARCHITECTURE_SYST_CSR = CORTEXM_ARCHITECTURE_SYST_CSR_CLKSOURCE
+                                      | CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE;
+    }
+
+  cortexm_architecture_cycles_reset ();
+
+  return true;
+
+#else
+
+  CORTEXM_ARCHITECTURE_DEMCR |= CORTEXM_ARCHITECTURE_DEMCR_TRCENA;
+#if defined(__ARM_ARCH_7EM__)
+  // Cortex-M7 requires the software lock to be released.
+  CORTEXM_ARCHITECTURE_DWT_LAR = CORTEXM_ARCHITECTURE_DWT_LAR_KEY;
+#endif
+
+  if ((CORTEXM_ARCHITECTURE_DWT_CTRL & CORTEXM_ARCHITECTURE_DWT_CTRL_NOCYCCNT)
+      != 0)
+    {
+      // The DWT is present, but without a cycle counter.
+      return false;
+    }
+
+  CORTEXM_ARCHITECTURE_DWT_CYCCNT = 0;
+  CORTEXM_ARCHITECTURE_DWT_CTRL |= CORTEXM_ARCHITECTURE_DWT_CTRL_CYCCNTENA;
+
+  cortexm_architecture_nop ();
+  cortexm_architecture_nop ();
+
+  // Some simulators implement the DWT as read-as-zero; the count
+  // does not advance.
+  if (CORTEXM_ARCHITECTURE_DWT_CYCCNT == 0)
+    {
+      return false;
+    }
+
+  cortexm_architecture_cycles_reset ();
+
+  return true;
+
+#endif
+}
+
+void
+cortexm_architecture_cycles_reset (void)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+  systick_count = 0;
+  systick_last = CORTEXM_ARCHITECTURE_SYST_CVR;
+#else
+  CORTEXM_ARCHITECTURE_DWT_CYCCNT = 0;
+#endif
+
+  cycles_high = 0;
+  cycles_last = 0;
+
+  cortexm_architecture_interrupts_set_primask (primask);
+}
+
+// Also called from the handlers above the BASEPRI level of the
+// critical sections, so the extension masks all of them with PRIMASK.
+uint64_t
+cortexm_architecture_cycles_read64 (void)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+  uint32_t now = cortexm_architecture_cycles_read ();
+  if (now < cycles_last)
+    {
+      ++cycles_high;
+    }
+  cycles_last = now;
+
+  uint64_t result = ((uint64_t)cycles_high << 32) | now;
+
+  cortexm_architecture_interrupts_set_primask (primask);
+
+  return result;
+}
+
+#if defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+
+uint32_t
+cortexm_architecture_cycles_systick_read (void)
+{
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+  // SysTick belongs to the tickless clock, with variable periods; use
+  // it instead (not restarted by reset()).
+  return (uint32_t)cortexm_architecture_tickless_now_cycles ();
+
+#else
+
+  // With PRIMASK, as read64().
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+  // SysTick counts down from RVR to 0, then reloads; a value higher
+  // than the previous one means a reload happened in between.
+  uint32_t current = CORTEXM_ARCHITECTURE_SYST_CVR;
+  uint32_t delta;
+  if (current <= systick_last)
+    {
+      delta = systick_last - current;
+    }
+  else
+    {
+      delta = systick_last + (CORTEXM_ARCHITECTURE_SYST_RVR + 1) - current;
+    }
+  systick_last = current;
+  systick_count += delta;
+
+  uint32_t result = systick_count;
+
+  cortexm_architecture_interrupts_set_primask (primask);
+
+  return result;
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+}
+
+#endif // defined(CORTEXM_ARCHITECTURE_CYCLES_USE_SYSTICK)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,210 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/exception-handlers.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <stddef.h>
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_fault_decode (cortexm_architecture_fault_frame_t* frame,
+                                   uint32_t* stack_pointer,
+                                   uint32_t exc_return)
+{
+  uint32_t* p = stack_pointer;
+
+  // ARMv8-M secure handlers may find the integrity signature, a
+  // reserved word and r4-r11 below the basic frame; the bit is always
+  // set on the other architectures.
+  if ((exc_return & CORTEXM_ARCHITECTURE_EXC_RETURN_DCRS) == 0)
+    {
+      p += 10;
+    }
+
+  frame->basic = (cortexm_architecture_context_exception_frame_t*)p;
+  frame->exc_return = exc_return;
+  p += sizeof (cortexm_architecture_context_exception_frame_t) / 4;
+
+  // The bit is always set on ARMv6-M and ARMv8-M Baseline.
+  if ((exc_return & CORTEXM_ARCHITECTURE_EXC_RETURN_FTYPE) == 0)
+    {
+      frame->extended = true;
+      frame->fpu = p;
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+      if (CORTEXM_ARCHITECTURE_FPU_FPCCR
+          & CORTEXM_ARCHITECTURE_FPU_FPCCR_LSPACT)
+        {
+          // The space is only reserved; the first FP instruction
+          // stores the registers there and clears LSPACT.
+          uint32_t fpscr;
+          __asm__ volatile(
+
+              " vmrs %0, fpscr "
+
+              : "=r"(fpscr) /* Outputs */
+              : /* Inputs */
+              : "memory" /* Clobbers */
+          );
+          (void)fpscr;
+        }
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_FPU)
+
+      // s0-s15, FPSCR and the reserved word.
+      p += 18;
+    }
+  else
+    {
+      frame->extended = false;
+      frame->fpu = NULL;
+    }
+
+  if (frame->basic->xpsr & CORTEXM_ARCHITECTURE_XPSR_ALIGNED)
+    {
+      // The frame was aligned to 8 bytes.
+      p += 1;
+    }
+  frame->caller_stack_pointer = p;
+}
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+void
+cortexm_architecture_fault_dispatch (uint32_t* stack_pointer,
+                                     uint32_t exc_return);
+
+static void __attribute__ ((naked))
+fault_entry_handler (void);
+
+void __attribute__ ((naked, alias ("fault_entry_handler")))
+HardFault_Handler (void);
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+void __attribute__ ((naked, alias ("fault_entry_handler")))
+MemManage_Handler (void);
+void __attribute__ ((naked, alias ("fault_entry_handler")))
+BusFault_Handler (void);
+// With the stack limits, UsageFault_Handler is in src/stack-overflow.c.
+#if !(defined(MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMITS) \
+      && (defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)))
+void __attribute__ ((naked, alias ("fault_entry_handler")))
+UsageFault_Handler (void);
+#endif
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+// Pass the active stack pointer and EXC_RETURN, with LR unchanged,
+// so the dispatcher returns directly from the exception.
+static void
+fault_entry_handler (void)
+{
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  __asm__ volatile(
+
+      " tst lr, #4 \n"
+      " ite eq \n"
+      " mrseq r0, msp \n"
+      " mrsne r0, psp \n"
+      " mov r1, lr \n"
+      " b cortexm_architecture_fault_dispatch \n"
+
+  );
+#else
+  __asm__ volatile(
+
+      " mov r1, lr \n"
+      " movs r0, #4 \n"
+      " tst r0, r1 \n"
+      " bne 1f \n"
+      " mrs r0, msp \n"
+      " b 2f \n"
+      "1: \n"
+      " mrs r0, psp \n"
+      "2: \n"
+      // The target may be out of range of a 16-bit branch.
+      " ldr r2, =cortexm_architecture_fault_dispatch \n"
+      " bx r2 \n"
+      " .ltorg \n"
+
+  );
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+}
+
+// Not static, to be reachable from the naked handler.
+void
+cortexm_architecture_fault_dispatch (uint32_t* stack_pointer,
+                                     uint32_t exc_return)
+{
+  cortexm_architecture_fault_status_t status = { 0 };
+  status.exception = cortexm_architecture_get_ipsr ()
+                     & CORTEXM_ARCHITECTURE_IPSR_EXCEPTION_MASK;
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  status.cfsr = CORTEXM_ARCHITECTURE_SCB_CFSR;
+  status.hfsr = CORTEXM_ARCHITECTURE_SCB_HFSR;
+  status.mmfar = CORTEXM_ARCHITECTURE_SCB_MMFAR;
+  status.bfar = CORTEXM_ARCHITECTURE_SCB_BFAR;
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+  cortexm_architecture_fault_frame_t frame;
+  cortexm_architecture_fault_decode (&frame, stack_pointer, exc_return);
+
+  if (cortexm_architecture_fault_handler (&frame, &status))
+    {
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+      // Only the bits seen by the handler; a new fault is not lost.
+      CORTEXM_ARCHITECTURE_SCB_CFSR = status.cfsr;
+      CORTEXM_ARCHITECTURE_SCB_HFSR = status.hfsr;
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+      cortexm_architecture_dsb ();
+      return;
+    }
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  cortexm_architecture_semihosting_output_flush_synchronous ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+  cortexm_architecture_crash_record_save (stack_pointer, exc_return);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+  // Wait for the debugger or the watchdog.
+  while (true)
+    {
+      cortexm_architecture_wfi ();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+bool __attribute__ ((weak))
+cortexm_architecture_fault_handler (
+    cortexm_architecture_fault_frame_t* frame,
+    const cortexm_architecture_fault_status_t* status)
+{
+  (void)frame;
+  (void)status;
+
+  return false;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS)
+
+#include <micro-os-plus/architecture.h>
+
+// ----------------------------------------------------------------------------
+
+// Must be a power of 2; the table is never resized.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE)
+#define MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE (512)
+#endif
+
+_Static_assert ((MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE
+                 & (MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE - 1))
+                    == 0,
+                "The profile size must be a power of 2");
+
+#define FUNCTION_PROFILE_MASK \
+  (MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE - 1)
+
+typedef struct function_profile_entry_s
+{
+  uint32_t function;
+  uint32_t count;
+} function_profile_entry_t;
+
+// Open addressing, with linear probing.
+static function_profile_entry_t
+    function_profile_table[MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE];
+
+// ----------------------------------------------------------------------------
+
+// The counters are not protected from interrupts; an increment may
+// be lost, and a function may get two entries, which the host script
+// adds together. Good enough for a profile, and cheap.
+void __attribute__ ((no_instrument_function))
+__cyg_profile_func_enter (void* function, void* call_site)
+{
+  (void)call_site;
+
+  uint32_t address = (uint32_t)function;
+  uint32_t index = ((address >> 1) * 2654435761UL) >> 16;
+
+  for (uint32_t i = 0; i < MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE;
+       ++i, ++index)
+    {
+      function_profile_entry_t* entry
+          = &function_profile_table[index & FUNCTION_PROFILE_MASK];
+      if (entry->function == address)
+        {
+          entry->count++;
+          return;
+        }
+      if (entry->function == 0)
+        {
+          entry->function = address;
+          entry->count = 1;
+          return;
+        }
+    }
+  // Full; the function is not counted.
+}
+
+void __attribute__ ((no_instrument_function))
+__cyg_profile_func_exit (void* function, void* call_site)
+{
+  (void)function;
+  (void)call_site;
+}
+
+// ----------------------------------------------------------------------------
+
+static char* __attribute__ ((no_instrument_function))
+function_profile_put_hex (char* p, uint32_t value)
+{
+  for (int shift = 28; shift >= 0; shift -= 4)
+    {
+      *p++ = "0123456789ABCDEF"[(value >> shift) & 0xF];
+    }
+  return p;
+}
+
+static char* __attribute__ ((no_instrument_function))
+function_profile_put_decimal (char* p, uint32_t value)
+{
+  char digits[10];
+  int n = 0;
+  do
+    {
+      digits[n++] = (char)('0' + value % 10);
+      value /= 10;
+    }
+  while (value != 0);
+
+  while (n > 0)
+    {
+      *p++ = digits[--n];
+    }
+  return p;
+}
+
+void __attribute__ ((no_instrument_function))
+cortexm_architecture_function_profile_dump (void)
+{
+  static const char prefix[] = "MICRO_OS_PLUS_PROFILE 0x";
+
+  for (uint32_t i = 0; i < MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE;
+       ++i)
+    {
+      function_profile_entry_t entry = function_profile_table[i];
+      if (entry.function == 0)
+        {
+          continue;
+        }
+
+      char line[sizeof (prefix) + 8 + 1 + 10 + 1];
+      char* p = line;
+      for (const char* q = prefix; *q != '\0'; ++q)
+        {
+          *p++ = *q;
+        }
+      p = function_profile_put_hex (p, entry.function);
+      *p++ = ' ';
+      p = function_profile_put_decimal (p, entry.count);
+      *p++ = '\n';
+      *p = '\0';
+
+      micro_os_plus_semihosting_call_host (
+          MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0,
+          (micro_os_plus_semihosting_param_block_t*)line);
+    }
+}
+
+void __attribute__ ((no_instrument_function))
+cortexm_architecture_function_profile_reset (void)
+{
+  for (uint32_t i = 0; i < MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS_SIZE;
+       ++i)
+    {
+      function_profile_table[i].function = 0;
+      function_profile_table[i].count = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_PROFILE_FUNCTIONS)
+
+// ----------------------------------------------------------------------------
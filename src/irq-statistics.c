@@ -0,0 +1,377 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+// ----------------------------------------------------------------------------
+
+// The buckets are indexed by log2 of 32-bit durations.
+_Static_assert (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS >= 1
+                    && MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS
+                               + MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SHIFT
+                           <= 32,
+                "The IRQ statistics buckets exceed the durations range");
+
+// The labels written by `cortexm_architecture_irq_statistics_format()`,
+// followed by the values and the commas, the new line and the
+// terminator.
+_Static_assert (
+    CORTEXM_ARCHITECTURE_IRQ_STATISTICS_LINE_SIZE
+        == sizeof ("MICRO_OS_PLUS_IRQ irq=" " count=" " min=" " avg="
+                   " max=" " latency_count=" " latency_avg="
+                   " latency_max=" " histogram=")
+               - 1 + 11 + 7 * 10
+               + 10 * MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS
+               + (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS - 1) + 2,
+    "The IRQ statistics line size does not match the format");
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+_Static_assert (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_IRQS
+                    <= MICRO_OS_PLUS_ARCHITECTURE_NVIC_IRQS,
+                "More IRQ statistics entries than device interrupts");
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_SYNTHETIC_POSIX)
+
+_Static_assert ((MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES
+                 & (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES - 1))
+                    == 0,
+                "The IRQ statistics samples must be a power of 2");
+
+#define SAMPLES_MASK (MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES - 1)
+
+static cortexm_architecture_irq_statistics_t
+    irq_statistics_table[CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT];
+
+volatile uint32_t cortexm_architecture_irq_statistics_pend_times
+    [CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT];
+
+cortexm_architecture_irq_statistics_runs_t
+    cortexm_architecture_irq_statistics_runs;
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+cortexm_architecture_vectors_handler_t
+    cortexm_architecture_irq_statistics_handlers
+        [CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT];
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_irq_statistics_record_pend (uint32_t exception)
+{
+  if (exception >= CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT)
+    {
+      return;
+    }
+
+  uint32_t now = cortexm_architecture_cycles_read ();
+  // 0 means unknown.
+  cortexm_architecture_irq_statistics_pend_times[exception]
+      = (now != 0) ? now : 1;
+}
+
+// ----------------------------------------------------------------------------
+
+// With PRIMASK set.
+static void
+irq_statistics_account (
+    const cortexm_architecture_irq_statistics_sample_t* sample)
+{
+  cortexm_architecture_irq_statistics_t* statistics
+      = &irq_statistics_table[sample->exception];
+  uint32_t duration = sample->duration;
+
+  if (statistics->count == 0 || duration < statistics->min)
+    {
+      statistics->min = duration;
+    }
+  if (duration > statistics->max)
+    {
+      statistics->max = duration;
+    }
+  statistics->count++;
+  statistics->total += duration;
+  statistics->histogram[cortexm_architecture_irq_statistics_bucket (
+      duration)]++;
+
+  uint32_t latency = sample->latency;
+  if (latency != CORTEXM_ARCHITECTURE_IRQ_STATISTICS_NO_LATENCY)
+    {
+      if (latency > statistics->latency_max)
+        {
+          statistics->latency_max = latency;
+        }
+      statistics->latency_count++;
+      statistics->latency_total += latency;
+    }
+}
+
+void
+cortexm_architecture_irq_statistics_fold (void)
+{
+  // One sample per critical section, to keep the interrupts latency
+  // short.
+  while (true)
+    {
+      uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+      cortexm_architecture_interrupts_disable ();
+
+      cortexm_architecture_irq_statistics_runs_t* runs
+          = &cortexm_architecture_irq_statistics_runs;
+      uint32_t tail = runs->tail;
+      bool empty = (tail == runs->head);
+      if (!empty)
+        {
+          irq_statistics_account (&runs->samples[tail & SAMPLES_MASK]);
+          runs->tail = tail + 1;
+        }
+
+      cortexm_architecture_interrupts_set_primask (primask);
+
+      if (empty)
+        {
+          return;
+        }
+    }
+}
+
+uint32_t
+cortexm_architecture_irq_statistics_dropped (void)
+{
+  return cortexm_architecture_irq_statistics_runs.dropped;
+}
+
+bool
+cortexm_architecture_irq_statistics_snapshot (
+    int32_t irq, cortexm_architecture_irq_statistics_t* statistics)
+{
+  if (irq < -16 || irq + 16 >= CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT)
+    {
+      return false;
+    }
+
+  cortexm_architecture_irq_statistics_fold ();
+
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+  {
+    *statistics = irq_statistics_table[irq + 16];
+  }
+  cortexm_architecture_interrupts_set_primask (primask);
+
+  return true;
+}
+
+void
+cortexm_architecture_irq_statistics_reset (void)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+  {
+    for (uint32_t i = 0; i < CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT; ++i)
+      {
+        irq_statistics_table[i]
+            = (cortexm_architecture_irq_statistics_t){ 0 };
+        cortexm_architecture_irq_statistics_pend_times[i] = 0;
+      }
+    cortexm_architecture_irq_statistics_runs.tail
+        = cortexm_architecture_irq_statistics_runs.head;
+    cortexm_architecture_irq_statistics_runs.dropped = 0;
+  }
+  cortexm_architecture_interrupts_set_primask (primask);
+}
+
+// ----------------------------------------------------------------------------
+
+typedef struct irq_statistics_writer_s
+{
+  char* buffer;
+  size_t size;
+  size_t length;
+} irq_statistics_writer_t;
+
+// The characters past the end of the buffer are counted but dropped.
+static void
+irq_statistics_put_char (irq_statistics_writer_t* writer, char c)
+{
+  if (writer->length + 1 < writer->size)
+    {
+      writer->buffer[writer->length] = c;
+    }
+  writer->length++;
+}
+
+static void
+irq_statistics_put_string (irq_statistics_writer_t* writer, const char* s)
+{
+  while (*s != '\0')
+    {
+      irq_statistics_put_char (writer, *s++);
+    }
+}
+
+static void
+irq_statistics_put_decimal (irq_statistics_writer_t* writer, uint32_t value)
+{
+  char digits[10];
+  int n = 0;
+  do
+    {
+      digits[n++] = (char)('0' + value % 10);
+      value /= 10;
+    }
+  while (value != 0);
+
+  while (n > 0)
+    {
+      irq_statistics_put_char (writer, digits[--n]);
+    }
+}
+
+size_t
+cortexm_architecture_irq_statistics_format (
+    int32_t irq, const cortexm_architecture_irq_statistics_t* statistics,
+    char* buffer, size_t size)
+{
+  irq_statistics_writer_t writer = { buffer, size, 0 };
+
+  irq_statistics_put_string (&writer, "MICRO_OS_PLUS_IRQ irq=");
+  if (irq < 0)
+    {
+      irq_statistics_put_char (&writer, '-');
+      irq_statistics_put_decimal (&writer, 0 - (uint32_t)irq);
+    }
+  else
+    {
+      irq_statistics_put_decimal (&writer, (uint32_t)irq);
+    }
+
+  irq_statistics_put_string (&writer, " count=");
+  irq_statistics_put_decimal (&writer, statistics->count);
+  irq_statistics_put_string (&writer, " min=");
+  irq_statistics_put_decimal (&writer, statistics->min);
+  irq_statistics_put_string (&writer, " avg=");
+  irq_statistics_put_decimal (
+      &writer, (statistics->count != 0)
+                   ? (uint32_t)(statistics->total / statistics->count)
+                   : 0);
+  irq_statistics_put_string (&writer, " max=");
+  irq_statistics_put_decimal (&writer, statistics->max);
+
+  irq_statistics_put_string (&writer, " latency_count=");
+  irq_statistics_put_decimal (&writer, statistics->latency_count);
+  irq_statistics_put_string (&writer, " latency_avg=");
+  irq_statistics_put_decimal (
+      &writer,
+      (statistics->latency_count != 0)
+          ? (uint32_t)(statistics->latency_total / statistics->latency_count)
+          : 0);
+  irq_statistics_put_string (&writer, " latency_max=");
+  irq_statistics_put_decimal (&writer, statistics->latency_max);
+
+  irq_statistics_put_string (&writer, " histogram=");
+  for (uint32_t i = 0; i < MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS;
+       ++i)
+    {
+      if (i != 0)
+        {
+          irq_statistics_put_char (&writer, ',');
+        }
+      irq_statistics_put_decimal (&writer, statistics->histogram[i]);
+    }
+  irq_statistics_put_char (&writer, '\n');
+
+  if (writer.length >= size)
+    {
+      // Truncated.
+      writer.length = (size != 0) ? size - 1 : 0;
+    }
+  if (size != 0)
+    {
+      buffer[writer.length] = '\0';
+    }
+  return writer.length;
+}
+
+void
+cortexm_architecture_irq_statistics_dump (void)
+{
+  for (uint32_t i = 0; i < CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT; ++i)
+    {
+      cortexm_architecture_irq_statistics_t statistics;
+      int32_t irq = (int32_t)i - 16;
+      if (!cortexm_architecture_irq_statistics_snapshot (irq, &statistics)
+          || statistics.count == 0)
+        {
+          continue;
+        }
+
+      char line[CORTEXM_ARCHITECTURE_IRQ_STATISTICS_LINE_SIZE];
+      cortexm_architecture_irq_statistics_format (irq, &statistics, line,
+                                                  sizeof (line));
+
+      micro_os_plus_semihosting_call_host (
+          MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0,
+          (micro_os_plus_semihosting_param_block_t*)line);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+void
+cortexm_architecture_irq_statistics_install (void)
+{
+  volatile cortexm_architecture_vectors_handler_t* vectors
+      = (volatile cortexm_architecture_vectors_handler_t*)
+          CORTEXM_ARCHITECTURE_SCB_VTOR;
+
+  // From SysTick (15) on; once only.
+  for (uint32_t i = 15; i < CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT; ++i)
+    {
+      if (vectors[i] == cortexm_architecture_irq_statistics_dispatch)
+        {
+          continue;
+        }
+      cortexm_architecture_irq_statistics_handlers[i] = vectors[i];
+      vectors[i] = cortexm_architecture_irq_statistics_dispatch;
+    }
+
+  cortexm_architecture_dsb ();
+  cortexm_architecture_isb ();
+}
+
+void
+cortexm_architecture_irq_statistics_dispatch (void)
+{
+  uint32_t begin = cortexm_architecture_cycles_read ();
+  uint32_t exception = cortexm_architecture_get_ipsr ()
+                       & CORTEXM_ARCHITECTURE_IPSR_EXCEPTION_MASK;
+
+  cortexm_architecture_irq_statistics_handlers[exception]();
+
+  cortexm_architecture_irq_statistics_record (
+      exception, begin, cortexm_architecture_cycles_read ());
+}
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+
+// ----------------------------------------------------------------------------
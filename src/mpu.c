@@ -0,0 +1,212 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
+
+// Linker script definitions.
+extern uint32_t __vectors_start;
+extern uint32_t __data_load_addr__;
+extern uint32_t __data_begin__;
+extern uint32_t __noncacheable_begin__;
+extern uint32_t __noncacheable_end__;
+extern uint32_t __fast_text_begin__;
+extern uint32_t __fast_text_end__;
+
+// The regions of the default profile.
+#define MPU_DEFAULT_REGIONS (4)
+
+// ----------------------------------------------------------------------------
+
+#if !defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+// The smallest block aligned to its size which covers the non empty
+// range [*begin, end); returns the size and aligns `*begin`.
+static uint32_t
+mpu_block (uint32_t* begin, uint32_t end)
+{
+  uint32_t size = 32;
+  while (size < 0x80000000UL
+         && (size < end - *begin || (*begin & ~(size - 1)) + size < end))
+    {
+      size <<= 1;
+    }
+  *begin &= ~(size - 1);
+  return size;
+}
+
+#endif // !defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+// Append [begin, end) to the table, if not empty; returns the new
+// count.
+static uint32_t
+mpu_append (cortexm_architecture_mpu_region_t* regions, uint32_t count,
+            uint32_t begin, uint32_t end, uint32_t access, uint32_t memory,
+            bool execute)
+{
+#if defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+  // Both ends rounded up, so adjacent ranges give adjacent regions.
+  begin = (begin + 31) & ~0x1FUL;
+  end = (end + 31) & ~0x1FUL;
+  if (end <= begin)
+    {
+      return count;
+    }
+  uint32_t size = end - begin;
+#else
+  if (end <= begin)
+    {
+      return count;
+    }
+  uint32_t size = mpu_block (&begin, end);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+  regions[count].rbar
+      = CORTEXM_ARCHITECTURE_MPU_RBAR (begin, size, access, memory, execute);
+  regions[count].attributes = CORTEXM_ARCHITECTURE_MPU_ATTRIBUTES (
+      begin, size, access, memory, execute);
+  return count + 1;
+}
+
+// ----------------------------------------------------------------------------
+
+bool
+cortexm_architecture_mpu_load (const cortexm_architecture_mpu_region_t* regions,
+                               uint32_t count)
+{
+  uint32_t available
+      = CORTEXM_ARCHITECTURE_MPU_TYPE_DREGION (CORTEXM_ARCHITECTURE_MPU_TYPE);
+  if (count > available)
+    {
+      return false;
+    }
+
+  cortexm_architecture_mpu_disable ();
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+  CORTEXM_ARCHITECTURE_MPU_MAIR0 = CORTEXM_ARCHITECTURE_MPU_MAIR0_VALUE;
+  CORTEXM_ARCHITECTURE_MPU_MAIR1 = CORTEXM_ARCHITECTURE_MPU_MAIR1_VALUE;
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+  // RBAR, RASR/RLAR and the three alias pairs, for four consecutive
+  // regions; a zero second word disables the region.
+  volatile uint32_t* pairs
+      = (volatile uint32_t*)CORTEXM_ARCHITECTURE_MPU_RBAR_ADDRESS;
+  for (uint32_t group = 0; group < available; group += 4)
+    {
+      CORTEXM_ARCHITECTURE_MPU_RNR = group;
+      for (uint32_t i = 0; i < 4 && group + i < available; ++i)
+        {
+          uint32_t number = group + i;
+          uint32_t rbar = 0;
+          uint32_t attributes = 0;
+          if (number < count)
+            {
+              rbar = regions[number].rbar;
+              attributes = regions[number].attributes;
+            }
+#if !defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+          rbar |= CORTEXM_ARCHITECTURE_MPU_RBAR_VALID | number;
+#endif // !defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+          pairs[2 * i] = rbar;
+          pairs[2 * i + 1] = attributes;
+        }
+    }
+
+  // Otherwise the violations escalate to HardFault.
+  CORTEXM_ARCHITECTURE_SCB_SHCSR = CORTEXM_ARCHITECTURE_SCB_SHCSR
+                                   | CORTEXM_ARCHITECTURE_SCB_SHCSR_MEMFAULTENA;
+
+  CORTEXM_ARCHITECTURE_MPU_CTRL = CORTEXM_ARCHITECTURE_MPU_CTRL_ENABLE
+                                  | CORTEXM_ARCHITECTURE_MPU_CTRL_PRIVDEFENA;
+  cortexm_architecture_dsb ();
+  cortexm_architecture_isb ();
+
+  return true;
+}
+
+bool
+cortexm_architecture_mpu_configure_default (void)
+{
+  cortexm_architecture_mpu_region_t regions[MPU_DEFAULT_REGIONS];
+  uint32_t count = 0;
+
+  uint32_t code_begin = (uint32_t)&__vectors_start;
+  // The end of the read only data, where the .data image starts.
+  uint32_t code_end = (uint32_t)&__data_load_addr__;
+  uint32_t ram_begin = (uint32_t)&__data_begin__;
+  uint32_t noncacheable_begin = (uint32_t)&__noncacheable_begin__;
+  uint32_t noncacheable_end = (uint32_t)&__noncacheable_end__;
+  uint32_t ram_end = (uint32_t)&__stack;
+
+  count = mpu_append (regions, count, code_begin, code_end,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_ONLY,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK, true);
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+  // The regions must not overlap, so the RAM is split around the
+  // non-cacheable section. No guard band: the startup sets MSPLIM
+  // above the bottom of the main stack, and the overflow handler
+  // uses the reserve left there, which a guard would fault.
+  count = mpu_append (regions, count, ram_begin, noncacheable_begin,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK, false);
+  count = mpu_append (regions, count, noncacheable_begin, noncacheable_end,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_NON_CACHEABLE, false);
+  count = mpu_append (regions, count, noncacheable_end, ram_end,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK, false);
+#else
+  // The higher numbered regions override the RAM region, which is
+  // rounded to a power of 2 and overrides the code region; if it
+  // covers code, with sections-ram.ld or with the ITCM aliased to
+  // RAM, it must remain executable.
+  uint32_t block_begin = ram_begin;
+  uint32_t block_last = block_begin + (mpu_block (&block_begin, ram_end) - 1);
+  uint32_t fast_text_begin = (uint32_t)&__fast_text_begin__;
+  uint32_t fast_text_end = (uint32_t)&__fast_text_end__;
+  bool ram_execute
+      = (code_begin < code_end && code_begin <= block_last
+         && code_end > block_begin)
+        || (fast_text_begin < fast_text_end && fast_text_begin <= block_last
+            && fast_text_end > block_begin);
+
+  count = mpu_append (regions, count, ram_begin, ram_end,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK,
+                      ram_execute);
+  count = mpu_append (regions, count, noncacheable_begin, noncacheable_end,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_READ_WRITE,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_NON_CACHEABLE, false);
+  // The first 32-byte block of the main stack.
+  uint32_t stack_bottom = (uint32_t)&__stack - (uint32_t)&__stack_size;
+  uint32_t guard_begin = (stack_bottom + 31) & ~0x1FUL;
+  count = mpu_append (regions, count, guard_begin, guard_begin + 32,
+                      CORTEXM_ARCHITECTURE_MPU_ACCESS_PRIVILEGED_READ_ONLY,
+                      CORTEXM_ARCHITECTURE_MPU_MEMORY_WRITE_BACK, false);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_MPU_PMSAV8)
+
+  return cortexm_architecture_mpu_load (regions, count);
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,257 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+
+#include <micro-os-plus/architecture.h>
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+// Must be a power of 2.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE)
+#define MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE (1024)
+#endif
+
+_Static_assert ((MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE
+                 & (MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE - 1))
+                    == 0,
+                "The semihosting output size must be a power of 2");
+
+// The writes flush when the ring holds at least this many bytes.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_THRESHOLD)
+#define MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_THRESHOLD \
+  (MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE / 2)
+#endif
+
+// The most bytes copied with the interrupts masked; longer writes are
+// copied in several critical sections, possibly interleaved with the
+// writes of the handlers.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_CHUNK)
+#define MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_CHUNK (32)
+#endif
+
+_Static_assert (MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_CHUNK > 0,
+                "The semihosting output chunk must not be empty");
+
+#define OUTPUT_SIZE MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_SIZE
+#define OUTPUT_MASK (OUTPUT_SIZE - 1)
+
+typedef struct semihosting_output_s
+{
+  // Free running indices; the producers advance the head in short
+  // critical sections, the context which owns the flush advances the
+  // tail, without masking the interrupts while the host is called.
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint32_t flushing;
+  volatile uint32_t dropped;
+  micro_os_plus_semihosting_response_t handle;
+  bool opened;
+  char buffer[OUTPUT_SIZE];
+} semihosting_output_t;
+
+static semihosting_output_t semihosting_output;
+
+// ----------------------------------------------------------------------------
+
+// The host console, opened on the first flush; if the open fails,
+// for example before the debugger is ready, it is retried on the
+// next flush, and the block is dropped and counted.
+static micro_os_plus_semihosting_response_t
+semihosting_output_handle (void)
+{
+  if (!semihosting_output.opened)
+    {
+      // Mode 4 is "w".
+      micro_os_plus_semihosting_param_block_t block[3] = {
+        (micro_os_plus_semihosting_param_block_t)":tt",
+        4,
+        3,
+      };
+      micro_os_plus_semihosting_response_t handle
+          = micro_os_plus_semihosting_call_host (
+              MICRO_OS_PLUS_SEMIHOSTING_SYS_OPEN, block);
+      if (handle == -1)
+        {
+          return handle;
+        }
+      semihosting_output.handle = handle;
+      semihosting_output.opened = true;
+    }
+  return semihosting_output.handle;
+}
+
+// One SYS_WRITE per contiguous block, at most two per wrap.
+static void
+semihosting_output_drain (void)
+{
+  uint32_t tail = semihosting_output.tail;
+  uint32_t head;
+  while ((head = semihosting_output.head) != tail)
+    {
+      uint32_t index = tail & OUTPUT_MASK;
+      uint32_t count = head - tail;
+      if (count > OUTPUT_SIZE - index)
+        {
+          count = OUTPUT_SIZE - index;
+        }
+
+      micro_os_plus_semihosting_response_t handle
+          = semihosting_output_handle ();
+      if (handle >= 0)
+        {
+          micro_os_plus_semihosting_param_block_t block[3] = {
+            (micro_os_plus_semihosting_param_block_t)handle,
+            (micro_os_plus_semihosting_param_block_t)&semihosting_output
+                .buffer[index],
+            count,
+          };
+          micro_os_plus_semihosting_call_host (
+              MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE, block);
+        }
+      else
+        {
+          cortexm_architecture_atomic_fetch_add (&semihosting_output.dropped,
+                                                 count);
+        }
+
+      tail += count;
+      // The bytes are read before the space is released.
+      cortexm_architecture_dmb ();
+      semihosting_output.tail = tail;
+    }
+}
+
+static bool
+semihosting_output_try_flush (void)
+{
+  if (cortexm_architecture_atomic_exchange (&semihosting_output.flushing, 1)
+      != 0)
+    {
+      // Interrupted a flush; the owner continues up to the new head.
+      return false;
+    }
+  semihosting_output_drain ();
+  semihosting_output.flushing = 0;
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+
+size_t
+cortexm_architecture_semihosting_output_write (const void* buffer,
+                                               size_t size)
+{
+  const char* bytes = (const char*)buffer;
+  size_t written = 0;
+  uint32_t used = 0;
+
+  while (written < size)
+    {
+      cortexm_architecture_interrupts_status_t status
+          = cortexm_architecture_interrupts_critical_section_enter ();
+
+      uint32_t head = semihosting_output.head;
+      used = head - semihosting_output.tail;
+      uint32_t count = OUTPUT_SIZE - used;
+      if (count > size - written)
+        {
+          count = (uint32_t)(size - written);
+        }
+      if (count > MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_CHUNK)
+        {
+          count = MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_CHUNK;
+        }
+
+      // In two parts around the end of the ring.
+      uint32_t index = head & OUTPUT_MASK;
+      uint32_t first = count;
+      if (first > OUTPUT_SIZE - index)
+        {
+          first = OUTPUT_SIZE - index;
+        }
+      memcpy (&semihosting_output.buffer[index], bytes + written, first);
+      memcpy (&semihosting_output.buffer[0], bytes + written + first,
+              count - first);
+
+      // The bytes are stored before they are published.
+      cortexm_architecture_dmb ();
+      semihosting_output.head = head + count;
+
+      cortexm_architecture_interrupts_critical_section_exit (status);
+
+      written += count;
+      used += count;
+
+      // Full; make room, unless the flush belongs to an interrupted
+      // context, which cannot run before this one returns.
+      if (count == 0 && !semihosting_output_try_flush ())
+        {
+          cortexm_architecture_atomic_fetch_add (
+              &semihosting_output.dropped, (uint32_t)(size - written));
+          return written;
+        }
+    }
+
+  if (used >= MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT_THRESHOLD)
+    {
+      semihosting_output_try_flush ();
+    }
+  return written;
+}
+
+size_t
+cortexm_architecture_semihosting_output_puts (const char* string)
+{
+  return cortexm_architecture_semihosting_output_write (string,
+                                                        strlen (string));
+}
+
+void
+cortexm_architecture_semihosting_output_flush (void)
+{
+  semihosting_output_try_flush ();
+}
+
+void
+cortexm_architecture_semihosting_output_flush_synchronous (void)
+{
+  // A flush interrupted by a fault never resumes, so its ownership
+  // is ignored.
+  cortexm_architecture_interrupts_status_t status
+      = cortexm_architecture_interrupts_critical_section_enter ();
+  semihosting_output_drain ();
+  cortexm_architecture_interrupts_critical_section_exit (status);
+}
+
+void
+cortexm_architecture_semihosting_output_idle (void)
+{
+  semihosting_output_try_flush ();
+  cortexm_architecture_wfi ();
+}
+
+uint32_t
+cortexm_architecture_semihosting_output_dropped (void)
+{
+  return semihosting_output.dropped;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+
+// ----------------------------------------------------------------------------
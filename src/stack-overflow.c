@@ -0,0 +1,159 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMITS)
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/exception-handlers.h>
+
+// On ARMv8-M Baseline there is no UsageFault; the stack limit
+// violations escalate to HardFault.
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_usage_fault_dispatch (uint32_t exc_return,
+                                           uint32_t* stack_pointer);
+
+void __attribute__ ((naked))
+UsageFault_Handler (void);
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+// In src/fault.c; the common entry of the fault handlers.
+void
+cortexm_architecture_fault_dispatch (uint32_t* stack_pointer,
+                                     uint32_t exc_return);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+// ----------------------------------------------------------------------------
+
+void
+UsageFault_Handler (void)
+{
+  __asm__ volatile(
+
+      // Lower MSPLIM to the bottom of the main stack, to give the
+      // handlers the reserve left by the startup; nothing is pushed
+      // before this. The previous limit is restored on return.
+      " mrs r2, msplim \n"
+      " ldr r0, =__stack \n"
+      " ldr r1, =__stack_size \n"
+      " subs r0, r0, r1 \n"
+      " msr msplim, r0 \n"
+      " isb \n"
+
+      " mov r0, lr \n"
+      " tst lr, #4 \n"
+      " ite eq \n"
+      " mrseq r1, msp \n"
+      " mrsne r1, psp \n"
+      " push {r2, lr} \n"
+      " bl cortexm_architecture_usage_fault_dispatch \n"
+      " pop {r2, lr} \n"
+
+      " msr msplim, r2 \n"
+      " isb \n"
+      " bx lr \n"
+      " .ltorg \n"
+
+  );
+}
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+// Where the hardware pushed the frame, for the crash record.
+static uint32_t* usage_fault_stack_pointer;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+// Not static, to be reachable from the naked handler, which restores
+// MSPLIM when it returns.
+void
+cortexm_architecture_usage_fault_dispatch (uint32_t exc_return,
+                                           uint32_t* stack_pointer)
+{
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+  usage_fault_stack_pointer = stack_pointer;
+#else
+  (void)stack_pointer;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+  if (CORTEXM_ARCHITECTURE_SCB_CFSR & CORTEXM_ARCHITECTURE_SCB_CFSR_STKOF)
+    {
+      CORTEXM_ARCHITECTURE_SCB_CFSR = CORTEXM_ARCHITECTURE_SCB_CFSR_STKOF;
+      cortexm_architecture_stack_overflow_handler (exc_return);
+    }
+  else
+    {
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+      // The other causes go to `cortexm_architecture_fault_handler()`,
+      // like those of the other faults; the frame is complete.
+      cortexm_architecture_fault_dispatch (stack_pointer, exc_return);
+#else
+      cortexm_architecture_usage_fault_handler (exc_return);
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void __attribute__ ((weak))
+cortexm_architecture_stack_overflow_handler (uint32_t exc_return)
+{
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  cortexm_architecture_semihosting_output_flush_synchronous ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+  cortexm_architecture_crash_record_save (usage_fault_stack_pointer,
+                                          exc_return);
+#else
+  (void)exc_return;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+  // Wait for the debugger or the watchdog.
+  while (true)
+    {
+      cortexm_architecture_wfi ();
+    }
+}
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+void __attribute__ ((weak))
+cortexm_architecture_usage_fault_handler (uint32_t exc_return)
+{
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  cortexm_architecture_semihosting_output_flush_synchronous ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+  cortexm_architecture_crash_record_save (usage_fault_stack_pointer,
+                                          exc_return);
+#else
+  (void)exc_return;
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_CRASH_RECORD)
+
+  while (true)
+    {
+      cortexm_architecture_wfi ();
+    }
+}
+
+#endif // !defined(MICRO_OS_PLUS_ARCHITECTURE_FAULT_HANDLERS)
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_STACK_LIMITS)
+
+// ----------------------------------------------------------------------------
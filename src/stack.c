@@ -0,0 +1,193 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// ----------------------------------------------------------------------------
+
+#define STACK_MAGIC MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC
+
+// The block size of the binary search, in words.
+#define STACK_BLOCK_WORDS (8)
+
+// ----------------------------------------------------------------------------
+
+// Eight words per iteration, which the compiler turns into STM bursts
+// (or STRD pairs); inlined, so painting the current stack does not
+// use any stack below the range being painted.
+static inline __attribute__ ((always_inline)) void
+stack_fill (uint32_t* p, uint32_t* top)
+{
+  while (p + 8 <= top)
+    {
+      p[0] = STACK_MAGIC;
+      p[1] = STACK_MAGIC;
+      p[2] = STACK_MAGIC;
+      p[3] = STACK_MAGIC;
+      p[4] = STACK_MAGIC;
+      p[5] = STACK_MAGIC;
+      p[6] = STACK_MAGIC;
+      p[7] = STACK_MAGIC;
+      p += 8;
+    }
+  while (p < top)
+    {
+      *p++ = STACK_MAGIC;
+    }
+}
+
+// The first word not painted, scanning up from `p`.
+static inline __attribute__ ((always_inline)) const uint32_t*
+stack_skip_painted (const uint32_t* p, const uint32_t* top)
+{
+  // Four words per iteration, with a single test.
+  while (p + 4 <= top
+         && ((p[0] ^ STACK_MAGIC) | (p[1] ^ STACK_MAGIC)
+             | (p[2] ^ STACK_MAGIC) | (p[3] ^ STACK_MAGIC))
+                == 0)
+    {
+      p += 4;
+    }
+  while (p < top && *p == STACK_MAGIC)
+    {
+      ++p;
+    }
+  return p;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_stack_paint (uint32_t* bottom, uint32_t* top)
+{
+  stack_fill (bottom, top);
+}
+
+void
+cortexm_architecture_stack_paint_main (void)
+{
+  // The current frame is above the stack pointer, and stack_fill()
+  // uses only registers.
+  stack_fill ((uint32_t*)((uint32_t)&__stack - (uint32_t)&__stack_size),
+              (uint32_t*)micro_os_plus_architecture_get_sp ());
+}
+
+cortexm_architecture_stack_descriptor_t
+cortexm_architecture_stack_main (void)
+{
+  cortexm_architecture_stack_descriptor_t stack = {
+    "main",
+    (uint32_t*)((uint32_t)&__stack - (uint32_t)&__stack_size),
+    &__stack,
+  };
+  return stack;
+}
+
+uint32_t
+cortexm_architecture_stack_used (const uint32_t* bottom, const uint32_t* top)
+{
+  return (uint32_t)(top - stack_skip_painted (bottom, top))
+         * sizeof (uint32_t);
+}
+
+uint32_t
+cortexm_architecture_stack_used_fast (const uint32_t* bottom,
+                                      const uint32_t* top)
+{
+  // Find the first block not entirely painted, assuming all blocks
+  // below the high-water mark are painted and all above are not.
+  uint32_t low = 0;
+  uint32_t high = (uint32_t)(top - bottom) / STACK_BLOCK_WORDS;
+  while (low < high)
+    {
+      uint32_t middle = low + (high - low) / 2;
+      const uint32_t* block = bottom + middle * STACK_BLOCK_WORDS;
+      if (stack_skip_painted (block, block + STACK_BLOCK_WORDS)
+          == block + STACK_BLOCK_WORDS)
+        {
+          low = middle + 1;
+        }
+      else
+        {
+          high = middle;
+        }
+    }
+
+  // Exact inside the block.
+  return cortexm_architecture_stack_used (bottom + low * STACK_BLOCK_WORDS,
+                                          top);
+}
+
+// ----------------------------------------------------------------------------
+
+static char*
+stack_put_string (char* p, const char* s)
+{
+  while (*s != '\0')
+    {
+      *p++ = *s++;
+    }
+  return p;
+}
+
+static char*
+stack_put_decimal (char* p, uint32_t value)
+{
+  char digits[10];
+  int n = 0;
+  do
+    {
+      digits[n++] = (char)('0' + value % 10);
+      value /= 10;
+    }
+  while (value != 0);
+
+  while (n > 0)
+    {
+      *p++ = digits[--n];
+    }
+  return p;
+}
+
+void
+cortexm_architecture_stack_report (
+    const cortexm_architecture_stack_descriptor_t* stacks, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      // The names are truncated to keep the line on the stack.
+      char line[20 + 32 + 1 + 10 + 1 + 10 + 1 + 1];
+      char* p = stack_put_string (line, "MICRO_OS_PLUS_STACK ");
+
+      const char* name = stacks[i].name;
+      for (int n = 0; n < 32 && *name != '\0'; ++n)
+        {
+          *p++ = *name++;
+        }
+      *p++ = ' ';
+      p = stack_put_decimal (
+          p, cortexm_architecture_stack_used (stacks[i].bottom, stacks[i].top));
+      *p++ = ' ';
+      p = stack_put_decimal (
+          p, (uint32_t)(stacks[i].top - stacks[i].bottom) * sizeof (uint32_t));
+      *p++ = '\n';
+      *p = '\0';
+
+      micro_os_plus_semihosting_call_host (
+          MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0,
+          (micro_os_plus_semihosting_param_block_t*)line);
+    }
+}
+
+// ----------------------------------------------------------------------------
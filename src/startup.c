@@ -0,0 +1,285 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// ----------------------------------------------------------------------------
+
+// The loops are naked functions, to have full control over the
+// registers used by the LDM/STM bursts; the arguments are in r0-r2.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+// 8-word bursts with r3-r9 & r12, then words.
+void __attribute__ ((naked))
+cortexm_architecture_startup_copy_words (const uint32_t* from,
+                                         uint32_t* region_begin,
+                                         uint32_t* region_end)
+{
+  __asm__(
+
+      " subs r2, r2, r1 \n" // r2 = size in bytes
+      " push {r4-r9} \n"
+
+      "1: \n"
+      " subs r2, r2, #32 \n"
+      " blo 2f \n"
+      " ldmia r0!, {r3-r9, r12} \n"
+      " stmia r1!, {r3-r9, r12} \n"
+      " b 1b \n"
+
+      "2: \n"
+      " adds r2, r2, #32 \n"
+      " cmp r2, #16 \n"
+      " blo 3f \n"
+      " ldmia r0!, {r3-r6} \n"
+      " stmia r1!, {r3-r6} \n"
+      " subs r2, r2, #16 \n"
+
+      "3: \n"
+      " subs r2, r2, #4 \n"
+      " blo 4f \n"
+      " ldr r3, [r0], #4 \n"
+      " str r3, [r1], #4 \n"
+      " b 3b \n"
+
+      "4: \n"
+      " pop {r4-r9} \n"
+      " bx lr \n"
+
+  );
+}
+
+// 8-word bursts of zeros in r2-r7, r12 & lr, then words.
+void __attribute__ ((naked))
+cortexm_architecture_startup_zero_words (uint32_t* region_begin,
+                                         uint32_t* region_end)
+{
+  __asm__(
+
+      " subs r1, r1, r0 \n" // r1 = size in bytes
+      " push {r4-r7, lr} \n"
+      " movs r2, #0 \n"
+      " movs r3, #0 \n"
+      " movs r4, #0 \n"
+      " movs r5, #0 \n"
+      " movs r6, #0 \n"
+      " movs r7, #0 \n"
+      " mov r12, r2 \n"
+      " mov lr, r2 \n"
+
+      "1: \n"
+      " subs r1, r1, #32 \n"
+      " blo 2f \n"
+      " stmia r0!, {r2-r7, r12, lr} \n"
+      " b 1b \n"
+
+      "2: \n"
+      " adds r1, r1, #32 \n"
+
+      "3: \n"
+      " subs r1, r1, #4 \n"
+      " blo 4f \n"
+      " str r2, [r0], #4 \n"
+      " b 3b \n"
+
+      "4: \n"
+      " pop {r4-r7, pc} \n"
+
+  );
+}
+
+#else
+
+// 4-word bursts with r3-r6, then words; ARMv6-M LDM/STM
+// accept only the low registers.
+void __attribute__ ((naked))
+cortexm_architecture_startup_copy_words (const uint32_t* from,
+                                         uint32_t* region_begin,
+                                         uint32_t* region_end)
+{
+  __asm__(
+
+      " subs r2, r2, r1 \n" // r2 = size in bytes
+      " push {r4-r6} \n"
+
+      "1: \n"
+      " subs r2, r2, #16 \n"
+      " bcc 2f \n"
+      " ldmia r0!, {r3-r6} \n"
+      " stmia r1!, {r3-r6} \n"
+      " b 1b \n"
+
+      "2: \n"
+      " adds r2, r2, #16 \n"
+      " beq 4f \n"
+
+      "3: \n"
+      " ldmia r0!, {r3} \n"
+      " stmia r1!, {r3} \n"
+      " subs r2, r2, #4 \n"
+      " bne 3b \n"
+
+      "4: \n"
+      " pop {r4-r6} \n"
+      " bx lr \n"
+
+  );
+}
+
+// 4-word bursts of zeros in r2-r5, then words.
+void __attribute__ ((naked))
+cortexm_architecture_startup_zero_words (uint32_t* region_begin,
+                                         uint32_t* region_end)
+{
+  __asm__(
+
+      " subs r1, r1, r0 \n" // r1 = size in bytes
+      " push {r4, r5} \n"
+      " movs r2, #0 \n"
+      " movs r3, #0 \n"
+      " movs r4, #0 \n"
+      " movs r5, #0 \n"
+
+      "1: \n"
+      " subs r1, r1, #16 \n"
+      " bcc 2f \n"
+      " stmia r0!, {r2-r5} \n"
+      " b 1b \n"
+
+      "2: \n"
+      " adds r1, r1, #16 \n"
+      " beq 4f \n"
+
+      "3: \n"
+      " stmia r0!, {r2} \n"
+      " subs r1, r1, #4 \n"
+      " bne 3b \n"
+
+      "4: \n"
+      " pop {r4, r5} \n"
+      " bx lr \n"
+
+  );
+}
+
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+
+#pragma GCC diagnostic pop
+
+// LZ4 block format: a token with the literals length in the high
+// nibble and the match length - 4 in the low nibble, both extended
+// with 255 bytes when 15, the literals, and a 16-bit offset back in
+// the output; the last sequence has no match.
+// Overlapping matches are copied forwards, which makes runs cheap.
+void
+cortexm_architecture_startup_decompress_words (const uint8_t* from,
+                                               uint32_t* region_begin,
+                                               uint32_t* region_end)
+{
+  uint8_t* to = (uint8_t*)region_begin;
+  uint8_t* end = (uint8_t*)region_end;
+
+  while (to < end)
+    {
+      uint32_t token = *from++;
+
+      uint32_t length = token >> 4;
+      if (length == 15)
+        {
+          uint32_t byte;
+          do
+            {
+              byte = *from++;
+              length += byte;
+            }
+          while (byte == 255);
+        }
+      while (length-- > 0)
+        {
+          *to++ = *from++;
+        }
+
+      if (to >= end)
+        {
+          break;
+        }
+
+      const uint8_t* match = to - (from[0] | (from[1] << 8));
+      from += 2;
+
+      length = (token & 0x0F) + 4;
+      if ((token & 0x0F) == 15)
+        {
+          uint32_t byte;
+          do
+            {
+              byte = *from++;
+              length += byte;
+            }
+          while (byte == 255);
+        }
+      while (length-- > 0)
+        {
+          *to++ = *match++;
+        }
+    }
+}
+
+void
+cortexm_architecture_startup_initialize_data (void)
+{
+  for (const uint32_t* p = &__data_regions_array_begin__;
+       p < &__data_regions_array_end__; p += 3)
+    {
+      uint32_t from = p[0];
+      uint32_t* region_begin = (uint32_t*)p[1];
+      uint32_t* region_end = (uint32_t*)p[2];
+
+      if (from & CORTEXM_ARCHITECTURE_STARTUP_DATA_COMPRESSED)
+        {
+          cortexm_architecture_startup_decompress_words (
+              (const uint8_t*)(from
+                               & ~CORTEXM_ARCHITECTURE_STARTUP_DATA_COMPRESSED),
+              region_begin, region_end);
+        }
+      else if (from != (uint32_t)region_begin)
+        {
+          // With sections-ram.ld the data is loaded in place.
+          cortexm_architecture_startup_copy_words ((const uint32_t*)from,
+                                                   region_begin, region_end);
+        }
+    }
+
+  // The records may include code (.fast_text); complete the writes
+  // before fetching from there.
+  cortexm_architecture_dsb ();
+  cortexm_architecture_isb ();
+}
+
+void
+cortexm_architecture_startup_initialize_bss (void)
+{
+  for (const uint32_t* p = &__bss_regions_array_begin__;
+       p < &__bss_regions_array_end__; p += 2)
+    {
+      cortexm_architecture_startup_zero_words ((uint32_t*)p[0],
+                                               (uint32_t*)p[1]);
+    }
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <atomic>
+#include <ctime>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  // The raw counter value that corresponds to zero.
+  std::atomic<uint64_t> cycles_base{ 0 };
+
+  inline __attribute__ ((always_inline)) uint64_t
+  raw_cycles (void)
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    // The time stamp counter; on modern processors it ticks at a
+    // constant rate, close to the nominal core frequency.
+    return __builtin_ia32_rdtsc ();
+#else
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC_RAW, &ts);
+    return static_cast<uint64_t> (ts.tv_sec) * 1000000000u
+           + static_cast<uint64_t> (ts.tv_nsec);
+#endif
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+uint64_t
+micro_os_plus_architecture_synthetic_posix_cycles (void)
+{
+  return raw_cycles () - cycles_base.load (std::memory_order_relaxed);
+}
+
+bool
+cortexm_architecture_cycles_enable (void)
+{
+  cortexm_architecture_cycles_reset ();
+
+  return true;
+}
+
+void
+cortexm_architecture_cycles_reset (void)
+{
+  cycles_base.store (raw_cycles (), std::memory_order_relaxed);
+}
+
+uint64_t
+cortexm_architecture_cycles_read64 (void)
+{
+  return micro_os_plus_architecture_synthetic_posix_cycles ();
+}
+
+// ----------------------------------------------------------------------------
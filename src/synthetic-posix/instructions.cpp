@@ -0,0 +1,74 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  // Non-zero when a wake-up was posted and not yet consumed by `wfi`.
+  // The futex word must be a plain 32-bit integer.
+  std::atomic<uint32_t> wakeup_pending{ 0 };
+
+  static_assert (sizeof (wakeup_pending) == sizeof (uint32_t));
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+void
+micro_os_plus_architecture_synthetic_posix_bkpt (void)
+{
+  std::raise (SIGTRAP);
+}
+
+void
+micro_os_plus_architecture_synthetic_posix_wfi (void)
+{
+  // Consume a pending wake-up, if any, and return at once.
+  while (wakeup_pending.exchange (0, std::memory_order_acquire) == 0)
+    {
+      // Sleep only if the word is still 0; EAGAIN (changed in the
+      // meantime) and EINTR (signal) simply retry the exchange.
+      syscall (SYS_futex, reinterpret_cast<uint32_t*> (&wakeup_pending),
+               FUTEX_WAIT_PRIVATE, 0, nullptr, nullptr, 0);
+    }
+}
+
+void
+micro_os_plus_architecture_synthetic_posix_wakeup (void)
+{
+  // Both the store and the raw syscall are async-signal-safe.
+  int saved_errno = errno;
+
+  wakeup_pending.store (1, std::memory_order_release);
+  syscall (SYS_futex, reinterpret_cast<uint32_t*> (&wakeup_pending),
+           FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+
+  errno = saved_errno;
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <csignal>
+
+#include <pthread.h>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  // Like PRIMASK, it is per core, i.e. per thread.
+  thread_local uint32_t primask = 0;
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+uint32_t
+micro_os_plus_architecture_synthetic_posix_get_primask (void)
+{
+  return primask;
+}
+
+void
+micro_os_plus_architecture_synthetic_posix_set_primask (uint32_t value)
+{
+  value &= 1;
+  if (value == primask)
+    {
+      return;
+    }
+
+  // The synchronous signals (faults) are never blocked, like
+  // HardFault is not masked by PRIMASK.
+  sigset_t set;
+  sigfillset (&set);
+  sigdelset (&set, SIGSEGV);
+  sigdelset (&set, SIGBUS);
+  sigdelset (&set, SIGFPE);
+  sigdelset (&set, SIGILL);
+  sigdelset (&set, SIGTRAP);
+
+  if (value != 0)
+    {
+      pthread_sigmask (SIG_BLOCK, &set, nullptr);
+      primask = value;
+    }
+  else
+    {
+      primask = value;
+      pthread_sigmask (SIG_UNBLOCK, &set, nullptr);
+    }
+}
+
+// ----------------------------------------------------------------------------
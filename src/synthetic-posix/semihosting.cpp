@@ -0,0 +1,346 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  using param_block_t = micro_os_plus_semihosting_param_block_t;
+  using response_t = micro_os_plus_semihosting_response_t;
+
+  // The errno of the last failed operation, for SYS_ERRNO.
+  int last_errno;
+
+  uint64_t
+  monotonic_ns (void)
+  {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t> (ts.tv_sec) * 1000000000u
+           + static_cast<uint64_t> (ts.tv_nsec);
+  }
+
+  // The reference for SYS_CLOCK and SYS_ELAPSED.
+  const uint64_t start_ns = monotonic_ns ();
+
+  template <typename T>
+  T*
+  pointer (param_block_t value)
+  {
+    return reinterpret_cast<T*> (value);
+  }
+
+  response_t
+  failed (int error)
+  {
+    last_errno = error;
+    return -1;
+  }
+
+  response_t
+  failed (void)
+  {
+    return failed (errno);
+  }
+
+  // Names are passed with an explicit length, not always terminated.
+  std::string
+  name (param_block_t address, param_block_t length)
+  {
+    return std::string (pointer<const char> (address), length);
+  }
+
+  // Map the fopen() mode index (0-11, "r", "rb", "r+", "r+b", "w", ...)
+  // to open() flags.
+  int
+  open_flags (param_block_t mode)
+  {
+    switch (mode >> 1)
+      {
+      case 0:
+        return O_RDONLY;
+      case 1:
+        return O_RDWR;
+      case 2:
+        return O_WRONLY | O_CREAT | O_TRUNC;
+      case 3:
+        return O_RDWR | O_CREAT | O_TRUNC;
+      case 4:
+        return O_WRONLY | O_CREAT | O_APPEND;
+      default:
+        return O_RDWR | O_CREAT | O_APPEND;
+      }
+  }
+
+  bool
+  is_stopped_reason (param_block_t value)
+  {
+    return (value >= MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_BRANCH_THROUGH_ZERO
+            && value <= MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_FIQ)
+           || (value >= MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_BREAK_POINT
+               && value <= MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_OS_SPECIFIC);
+  }
+
+  [[noreturn]] void
+  exit_with (param_block_t reason, param_block_t subcode)
+  {
+    std::fflush (stdout);
+    if (reason == MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_APPLICATION_EXIT)
+      {
+        std::exit (static_cast<int> (subcode));
+      }
+    std::exit (EXIT_FAILURE);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+micro_os_plus_semihosting_response_t
+micro_os_plus_architecture_synthetic_posix_semihosting (
+    int reason, micro_os_plus_semihosting_param_block_t* arg)
+{
+  switch (reason)
+    {
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_OPEN:
+      {
+        std::string path = name (arg[0], arg[2]);
+        if (path == ":tt")
+          {
+            // The console; the mode selects stdin, stdout or stderr.
+            return (arg[1] < 4) ? STDIN_FILENO
+                                : ((arg[1] < 8) ? STDOUT_FILENO
+                                                : STDERR_FILENO);
+          }
+        int fd = open (path.c_str (), open_flags (arg[1]), 0644);
+        return (fd < 0) ? failed () : fd;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_CLOSE:
+      {
+        int fd = static_cast<int> (arg[0]);
+        if (fd <= STDERR_FILENO)
+          {
+            // Do not close the host console.
+            return 0;
+          }
+        return (close (fd) < 0) ? failed () : 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITEC:
+      return (write (STDOUT_FILENO, arg, 1) < 0) ? failed () : 0;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0:
+      {
+        const char* str = reinterpret_cast<const char*> (arg);
+        return (write (STDOUT_FILENO, str, std::strlen (str)) < 0)
+                   ? failed ()
+                   : 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE:
+      {
+        // Returns the number of bytes not written.
+        ssize_t count = write (static_cast<int> (arg[0]),
+                               pointer<const void> (arg[1]), arg[2]);
+        if (count < 0)
+          {
+            failed ();
+            return static_cast<response_t> (arg[2]);
+          }
+        return static_cast<response_t> (arg[2] - count);
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_READ:
+      {
+        // Returns the number of bytes not read; all of them at EOF.
+        ssize_t count = read (static_cast<int> (arg[0]),
+                              pointer<void> (arg[1]), arg[2]);
+        if (count < 0)
+          {
+            failed ();
+            return static_cast<response_t> (arg[2]);
+          }
+        return static_cast<response_t> (arg[2] - count);
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_READC:
+      {
+        unsigned char ch;
+        return (read (STDIN_FILENO, &ch, 1) != 1) ? failed () : ch;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_ISERROR:
+      return (static_cast<response_t> (arg[0]) < 0) ? 1 : 0;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_ISTTY:
+      return isatty (static_cast<int> (arg[0]));
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_SEEK:
+      return (lseek (static_cast<int> (arg[0]), static_cast<off_t> (arg[1]),
+                     SEEK_SET)
+              < 0)
+                 ? failed ()
+                 : 0;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_FLEN:
+      {
+        struct stat st;
+        return (fstat (static_cast<int> (arg[0]), &st) < 0)
+                   ? failed ()
+                   : static_cast<response_t> (st.st_size);
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_TMPNAM:
+      {
+        int length = std::snprintf (pointer<char> (arg[0]), arg[2],
+                                    "/tmp/micro-os-plus-%d-%03u.tmp",
+                                    static_cast<int> (getpid ()),
+                                    static_cast<unsigned int> (arg[1]));
+        return (length < 0 || static_cast<param_block_t> (length) >= arg[2])
+                   ? -1
+                   : 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_REMOVE:
+      return (unlink (name (arg[0], arg[1]).c_str ()) < 0)
+                 ? (failed (), last_errno)
+                 : 0;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_RENAME:
+      return (std::rename (name (arg[0], arg[1]).c_str (),
+                           name (arg[2], arg[3]).c_str ())
+              < 0)
+                 ? (failed (), last_errno)
+                 : 0;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_CLOCK:
+      // Centiseconds since the start.
+      return static_cast<response_t> ((monotonic_ns () - start_ns)
+                                      / 10000000u);
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_TIME:
+      return static_cast<response_t> (std::time (nullptr));
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_SYSTEM:
+      std::fflush (stdout);
+      return std::system (name (arg[0], arg[1]).c_str ());
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_ERRNO:
+      return last_errno;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_GET_CMDLINE:
+      {
+        int fd = open ("/proc/self/cmdline", O_RDONLY);
+        if (fd < 0)
+          {
+            return failed ();
+          }
+        std::string line;
+        char chunk[256];
+        ssize_t count;
+        while ((count = read (fd, chunk, sizeof (chunk))) > 0)
+          {
+            line.append (chunk, static_cast<size_t> (count));
+          }
+        int error = errno;
+        close (fd);
+        if (count < 0)
+          {
+            return failed (error);
+          }
+
+        // The arguments are separated by spaces, not by NULs.
+        while (!line.empty () && line.back () == '\0')
+          {
+            line.pop_back ();
+          }
+        for (char& c : line)
+          {
+            if (c == '\0')
+              {
+                c = ' ';
+              }
+          }
+        // With the terminator.
+        if (line.size () >= arg[1])
+          {
+            return failed (ERANGE);
+          }
+        std::memcpy (pointer<char> (arg[0]), line.c_str (), line.size () + 1);
+        arg[1] = static_cast<param_block_t> (line.size ());
+        return 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_HEAPINFO:
+      {
+        // Zeros let the C library use its own defaults.
+        param_block_t* block = pointer<param_block_t> (arg[0]);
+        for (int i = 0; i < 4; ++i)
+          {
+            block[i] = 0;
+          }
+        return 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_EXIT:
+      {
+        // On 32-bit targets the argument is the reason itself, and
+        // the application exit status is 0; on 64-bit it points to a
+        // (reason, subcode) block, never at the low addresses of the
+        // reasons.
+        param_block_t value = reinterpret_cast<param_block_t> (arg);
+        if (is_stopped_reason (value))
+          {
+            exit_with (value, 0);
+          }
+        exit_with (arg[0], arg[1]);
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_EXIT_EXTENDED:
+      exit_with (arg[0], arg[1]);
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_ELAPSED:
+      {
+        // The registers are 64-bit wide, a single word holds the count.
+        arg[0] = static_cast<param_block_t> (monotonic_ns () - start_ns);
+        return 0;
+      }
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_TICKFREQ:
+      return 1000000000;
+
+    default:
+      last_errno = ENOSYS;
+      return -1;
+    }
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,341 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <assert.h>
+
+// ----------------------------------------------------------------------------
+
+// Near the end of a period, the reload value is not changed, since
+// the period it would apply to is not known; the wrap is awaited.
+#define TICKLESS_GUARD_CYCLES (64)
+
+_Static_assert (MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES
+                    > 2 * TICKLESS_GUARD_CYCLES,
+                "The minimum tickless period is too short");
+
+_Static_assert (MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES
+                    <= CORTEXM_ARCHITECTURE_SYST_RVR_MAX,
+                "The minimum tickless period does not fit SysTick");
+
+typedef struct tickless_epoch_s
+{
+  // The clock at the beginning of the current period.
+  uint64_t base;
+  // The current period is reload + 1 cycles long.
+  uint32_t reload;
+  // Loaded by SysTick at the end of the current period.
+  uint32_t next_reload;
+  // The end of the previous period was accounted before the
+  // SysTick handler, which is still pending.
+  bool wrap_accounted;
+} tickless_epoch_t;
+
+// The copy updated by the writers, with PRIMASK set.
+static tickless_epoch_t tickless_epoch;
+
+// The copies read by the readers; the generation selects the
+// current one, and the writers update the other one.
+static volatile tickless_epoch_t tickless_epochs[2];
+static volatile uint32_t tickless_generation;
+
+static uint64_t tickless_deadline = CORTEXM_ARCHITECTURE_TICKLESS_NO_DEADLINE;
+static uint32_t tickless_clock_hz;
+
+// ----------------------------------------------------------------------------
+
+// All the functions below, up to the public ones, are called with
+// PRIMASK set.
+
+static void
+tickless_publish (void)
+{
+  uint32_t generation = tickless_generation + 1;
+  tickless_epochs[generation & 1] = tickless_epoch;
+  tickless_generation = generation;
+}
+
+static void
+tickless_wrap (void)
+{
+  tickless_epoch.base += (uint64_t)tickless_epoch.reload + 1;
+  tickless_epoch.reload = tickless_epoch.next_reload;
+}
+
+// Account the end of the period if it was not yet seen by the
+// handler; the interrupt remains pending, to process the deadline.
+// Returns the SysTick value.
+//
+// SysTick pends the interrupt when it reaches 0, and reloads only at
+// its next clock; a 0 is the last value of the old period, even with
+// the interrupt pending, and a reload after a 0 was already seen
+// pending, or accounted by the handler.
+static uint32_t
+tickless_sync (void)
+{
+  uint32_t before = CORTEXM_ARCHITECTURE_SYST_CVR;
+  bool pending = (CORTEXM_ARCHITECTURE_SCB_ICSR
+                  & CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET)
+                 != 0;
+  uint32_t current = CORTEXM_ARCHITECTURE_SYST_CVR;
+
+  if (((pending && current != 0) || (before != 0 && current > before))
+      && !tickless_epoch.wrap_accounted)
+    {
+      tickless_wrap ();
+      tickless_epoch.wrap_accounted = true;
+      tickless_publish ();
+    }
+
+  return current;
+}
+
+// End the current period early and start one of the given length.
+// The few cycles between reading the counter and the reload are not
+// accounted.
+static void
+tickless_restart (uint32_t length)
+{
+  CORTEXM_ARCHITECTURE_SYST_RVR = length - 1;
+  uint32_t current = CORTEXM_ARCHITECTURE_SYST_CVR;
+  // Any write clears it; SysTick reloads at its next clock, without
+  // an interrupt.
+  CORTEXM_ARCHITECTURE_SYST_CVR = 0;
+
+  tickless_epoch.base += (uint64_t)(tickless_epoch.reload - current) + 1;
+  tickless_epoch.reload = length - 1;
+
+  // The reload must use this length, not the next one.
+  while (CORTEXM_ARCHITECTURE_SYST_CVR == 0)
+    {
+      ;
+    }
+}
+
+// Make the current period end at the deadline, if it is earlier,
+// and set the length of the next period.
+static void
+tickless_schedule (void)
+{
+  uint32_t current = tickless_sync ();
+  if (current < TICKLESS_GUARD_CYCLES)
+    {
+      uint32_t previous;
+      do
+        {
+          previous = current;
+          current = CORTEXM_ARCHITECTURE_SYST_CVR;
+        }
+      while (current <= previous);
+      current = tickless_sync ();
+    }
+
+  uint64_t now = tickless_epoch.base + (tickless_epoch.reload - current);
+  uint64_t end = tickless_epoch.base + tickless_epoch.reload + 1;
+  uint64_t deadline = tickless_deadline;
+
+  if (deadline < end)
+    {
+      uint64_t length = (deadline > now) ? (deadline - now) : 0;
+      if (length < MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES)
+        {
+          length = MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES;
+        }
+      if (now + length < end)
+        {
+          tickless_restart ((uint32_t)length);
+          end = tickless_epoch.base + tickless_epoch.reload + 1;
+        }
+    }
+
+  // The next period ends at the deadline, if it is close enough;
+  // otherwise the clock is kept with the longest periods.
+  uint64_t length = (uint64_t)CORTEXM_ARCHITECTURE_SYST_RVR_MAX + 1;
+  if (deadline > end && deadline - end < length)
+    {
+      length = deadline - end;
+    }
+  if (length < MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES)
+    {
+      length = MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES;
+    }
+
+  CORTEXM_ARCHITECTURE_SYST_RVR = (uint32_t)length - 1;
+  tickless_epoch.next_reload = (uint32_t)length - 1;
+  tickless_publish ();
+}
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_tickless_initialize (uint32_t clock_hz)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+  tickless_clock_hz = clock_hz;
+  tickless_deadline = CORTEXM_ARCHITECTURE_TICKLESS_NO_DEADLINE;
+
+  CORTEXM_ARCHITECTURE_SYST_CSR = 0;
+  CORTEXM_ARCHITECTURE_SYST_RVR = CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+  CORTEXM_ARCHITECTURE_SYST_CVR = 0;
+  CORTEXM_ARCHITECTURE_SCB_ICSR = CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTCLR;
+
+  tickless_epoch.base = 0;
+  tickless_epoch.reload = CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+  tickless_epoch.next_reload = CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+  tickless_epoch.wrap_accounted = false;
+  tickless_publish ();
+
+  CORTEXM_ARCHITECTURE_SYST_CSR = CORTEXM_ARCHITECTURE_SYST_CSR_CLKSOURCE
+                                  | CORTEXM_ARCHITECTURE_SYST_CSR_TICKINT
+                                  | CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE;
+
+  // The clock starts at the first reload.
+  while (CORTEXM_ARCHITECTURE_SYST_CVR == 0)
+    {
+      ;
+    }
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_USE_WFE)
+  CORTEXM_ARCHITECTURE_SCB_SCR |= CORTEXM_ARCHITECTURE_SCB_SCR_SEVONPEND;
+#endif
+
+  cortexm_architecture_interrupts_set_primask (primask);
+}
+
+// Lock free; a writer can preempt the reader, but not the other way
+// around, so a changed generation means a retry.
+uint64_t
+cortexm_architecture_tickless_now_cycles (void)
+{
+  for (;;)
+    {
+      uint32_t generation = tickless_generation;
+      tickless_epoch_t epoch = tickless_epochs[generation & 1];
+
+      uint32_t current = CORTEXM_ARCHITECTURE_SYST_CVR;
+      if (!epoch.wrap_accounted
+          && (CORTEXM_ARCHITECTURE_SCB_ICSR
+              & CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET)
+                 != 0)
+        {
+          // The period ended, but the handler did not run yet; the
+          // value is read again, in case the end was after the
+          // first read. Until the reload it is 0, the last value of
+          // the old period.
+          current = CORTEXM_ARCHITECTURE_SYST_CVR;
+          if (current != 0)
+            {
+              epoch.base += (uint64_t)epoch.reload + 1;
+              epoch.reload = epoch.next_reload;
+            }
+        }
+
+      if (generation == tickless_generation)
+        {
+          return epoch.base + (epoch.reload - current);
+        }
+    }
+}
+
+uint64_t
+cortexm_architecture_tickless_cycles_to_ns (uint64_t cycles)
+{
+  return cortexm_architecture_tickless_cycles_to_ns_at (cycles,
+                                                        tickless_clock_hz);
+}
+
+uint64_t
+cortexm_architecture_tickless_ns_to_cycles (uint64_t ns)
+{
+  return cortexm_architecture_tickless_ns_to_cycles_at (ns,
+                                                        tickless_clock_hz);
+}
+
+void
+cortexm_architecture_tickless_set_deadline (uint64_t deadline)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+  tickless_deadline = deadline;
+  tickless_schedule ();
+
+  cortexm_architecture_interrupts_set_primask (primask);
+}
+
+bool
+cortexm_architecture_tickless_interrupt_handler (void)
+{
+  uint32_t primask = cortexm_architecture_interrupts_get_primask ();
+  cortexm_architecture_interrupts_disable ();
+
+  // The end of the period pended the interrupt.
+  if (!tickless_epoch.wrap_accounted)
+    {
+      tickless_wrap ();
+    }
+  tickless_epoch.wrap_accounted = false;
+  tickless_publish ();
+
+  // The periods end at the deadline, or later.
+  bool expired = (tickless_deadline <= tickless_epoch.base);
+  if (expired)
+    {
+      tickless_deadline = CORTEXM_ARCHITECTURE_TICKLESS_NO_DEADLINE;
+    }
+
+  tickless_schedule ();
+
+  cortexm_architecture_interrupts_set_primask (primask);
+
+  return expired;
+}
+
+uint64_t
+cortexm_architecture_tickless_idle (uint64_t deadline)
+{
+  // Otherwise an interrupt after the caller's check would be taken
+  // before the sleep, which could then miss its work.
+  assert (cortexm_architecture_interrupts_get_primask () != 0);
+
+  tickless_deadline = deadline;
+  tickless_schedule ();
+
+  // Complete the SysTick writes before sleeping.
+  cortexm_architecture_dsb ();
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_USE_WFE)
+  // May return early, if the event register was set.
+  cortexm_architecture_wfe ();
+#else
+  cortexm_architecture_wfi ();
+#endif
+
+  // SysTick keeps counting during sleep, and the end of the period
+  // wakes the core, so at most one end is not yet accounted.
+  uint32_t current = tickless_sync ();
+
+  return tickless_epoch.base + (tickless_epoch.reload - current);
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,265 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE)
+
+#include <micro-os-plus/architecture.h>
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+// The identifier searched by the host tools; at most 15 characters.
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_ID)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_ID "SEGGER RTT"
+#endif
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_SIZE)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_SIZE (1024)
+#endif
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_SIZE)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_SIZE (16)
+#endif
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE_MODE)
+#define MICRO_OS_PLUS_ARCHITECTURE_TRACE_MODE \
+  CORTEXM_ARCHITECTURE_TRACE_MODE_SKIP
+#endif
+
+_Static_assert (sizeof (MICRO_OS_PLUS_ARCHITECTURE_TRACE_ID) <= 16,
+                "The trace identifier must fit the control block");
+
+// Early in RAM, where the host tools start scanning for the identifier.
+__attribute__ ((section (".trace"), used))
+cortexm_architecture_trace_control_t cortexm_architecture_trace_control;
+
+static char trace_up_buffer[MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_SIZE];
+static char trace_down_buffer[MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_SIZE];
+
+// ----------------------------------------------------------------------------
+
+static void
+trace_configure (cortexm_architecture_trace_channel_t* channel,
+                 const char* name, void* buffer, uint32_t size,
+                 uint32_t mode)
+{
+  channel->name = name;
+  channel->buffer = (char*)buffer;
+  channel->size = size;
+  channel->write_offset = 0;
+  channel->read_offset = 0;
+  channel->flags = mode;
+}
+
+// The free space; the bytes up to read_offset - 1.
+static inline __attribute__ ((always_inline)) uint32_t
+trace_available (const cortexm_architecture_trace_channel_t* channel,
+                 uint32_t write_offset)
+{
+  uint32_t read_offset = channel->read_offset;
+  if (read_offset > write_offset)
+    {
+      return read_offset - write_offset - 1;
+    }
+  return channel->size - 1 - write_offset + read_offset;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_trace_initialize (void)
+{
+  cortexm_architecture_trace_control_t* control
+      = &cortexm_architecture_trace_control;
+
+  // The section is not initialised by the startup.
+  memset (control, 0, sizeof (*control));
+
+  control->up_channels = MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS;
+  control->down_channels = MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS;
+  trace_configure (&control->up[0], "Terminal", trace_up_buffer,
+                   sizeof (trace_up_buffer),
+                   MICRO_OS_PLUS_ARCHITECTURE_TRACE_MODE);
+  trace_configure (&control->down[0], "Terminal", trace_down_buffer,
+                   sizeof (trace_down_buffer), 0);
+
+  // The host must not find the identifier before the channels.
+  cortexm_architecture_dmb ();
+  memcpy (control->id, MICRO_OS_PLUS_ARCHITECTURE_TRACE_ID,
+          sizeof (MICRO_OS_PLUS_ARCHITECTURE_TRACE_ID));
+  cortexm_architecture_dmb ();
+}
+
+void
+cortexm_architecture_trace_configure_up_channel (uint32_t channel,
+                                                 const char* name,
+                                                 void* buffer, uint32_t size,
+                                                 uint32_t mode)
+{
+  if (channel < MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS)
+    {
+      cortexm_architecture_interrupts_status_t status
+          = cortexm_architecture_interrupts_critical_section_enter ();
+      trace_configure (&cortexm_architecture_trace_control.up[channel], name,
+                       buffer, size, mode);
+      cortexm_architecture_interrupts_critical_section_exit (status);
+    }
+}
+
+void
+cortexm_architecture_trace_configure_down_channel (uint32_t channel,
+                                                   const char* name,
+                                                   void* buffer,
+                                                   uint32_t size)
+{
+  if (channel < MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS)
+    {
+      cortexm_architecture_interrupts_status_t status
+          = cortexm_architecture_interrupts_critical_section_enter ();
+      trace_configure (&cortexm_architecture_trace_control.down[channel],
+                       name, buffer, size, 0);
+      cortexm_architecture_interrupts_critical_section_exit (status);
+    }
+}
+
+size_t
+cortexm_architecture_trace_write (uint32_t channel, const void* buffer,
+                                  size_t size)
+{
+  if (channel >= MICRO_OS_PLUS_ARCHITECTURE_TRACE_UP_CHANNELS)
+    {
+      return 0;
+    }
+
+  cortexm_architecture_trace_channel_t* up
+      = &cortexm_architecture_trace_control.up[channel];
+  if (up->size == 0)
+    {
+      return 0;
+    }
+
+  const char* bytes = (const char*)buffer;
+  size_t written = 0;
+
+  // The writers are serialised; in the blocking mode the host
+  // empties the ring while the interrupts are masked.
+  cortexm_architecture_interrupts_status_t status
+      = cortexm_architecture_interrupts_critical_section_enter ();
+
+  uint32_t write_offset = up->write_offset;
+  while (written < size)
+    {
+      uint32_t available = trace_available (up, write_offset);
+      if (up->flags == CORTEXM_ARCHITECTURE_TRACE_MODE_SKIP
+          && available < size)
+        {
+          break;
+        }
+
+      uint32_t count = available;
+      if (count > size - written)
+        {
+          count = (uint32_t)(size - written);
+        }
+
+      // In two parts around the end of the ring.
+      uint32_t first = count;
+      if (first > up->size - write_offset)
+        {
+          first = up->size - write_offset;
+        }
+      memcpy (up->buffer + write_offset, bytes + written, first);
+      memcpy (up->buffer, bytes + written + first, count - first);
+
+      write_offset += count;
+      if (write_offset >= up->size)
+        {
+          write_offset -= up->size;
+        }
+
+      // The bytes are stored before they are published.
+      cortexm_architecture_dmb ();
+      up->write_offset = write_offset;
+      written += count;
+
+      if (up->flags != CORTEXM_ARCHITECTURE_TRACE_MODE_BLOCK)
+        {
+          break;
+        }
+    }
+
+  cortexm_architecture_interrupts_critical_section_exit (status);
+
+  return written;
+}
+
+size_t
+cortexm_architecture_trace_puts (const char* string)
+{
+  return cortexm_architecture_trace_write (0, string, strlen (string));
+}
+
+size_t
+cortexm_architecture_trace_read (uint32_t channel, void* buffer, size_t size)
+{
+  if (channel >= MICRO_OS_PLUS_ARCHITECTURE_TRACE_DOWN_CHANNELS)
+    {
+      return 0;
+    }
+
+  cortexm_architecture_trace_channel_t* down
+      = &cortexm_architecture_trace_control.down[channel];
+  char* bytes = (char*)buffer;
+  size_t done = 0;
+
+  cortexm_architecture_interrupts_status_t status
+      = cortexm_architecture_interrupts_critical_section_enter ();
+
+  uint32_t read_offset = down->read_offset;
+  uint32_t write_offset = down->write_offset;
+  // The bytes are read after the offset which publishes them.
+  cortexm_architecture_dmb ();
+
+  while (done < size && read_offset != write_offset)
+    {
+      uint32_t end = (write_offset > read_offset) ? write_offset : down->size;
+      uint32_t count = end - read_offset;
+      if (count > size - done)
+        {
+          count = (uint32_t)(size - done);
+        }
+      memcpy (bytes + done, down->buffer + read_offset, count);
+      done += count;
+      read_offset += count;
+      if (read_offset >= down->size)
+        {
+          read_offset = 0;
+        }
+    }
+
+  // The bytes are read before the space is released.
+  cortexm_architecture_dmb ();
+  down->read_offset = read_offset;
+
+  cortexm_architecture_interrupts_critical_section_exit (status);
+
+  return done;
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_TRACE)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+#include <micro-os-plus/architecture-cortexm/exception-handlers.h>
+
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+// ----------------------------------------------------------------------------
+
+// Linker script definitions.
+extern uint32_t __vectors_start;
+extern uint32_t __vectors_end;
+
+// Not initialised; the linker script checks that it is not smaller
+// than `.interrupt_vectors`.
+static cortexm_architecture_vectors_handler_t
+    ram_vectors[CORTEXM_ARCHITECTURE_VECTORS_COUNT]
+    __attribute__ ((section (".ram_vectors"),
+                    aligned (CORTEXM_ARCHITECTURE_VECTORS_ALIGNMENT), used));
+
+// ----------------------------------------------------------------------------
+
+void
+cortexm_architecture_vectors_relocate (void)
+{
+  uint32_t copied = (uint32_t)(&__vectors_end - &__vectors_start);
+  cortexm_architecture_startup_copy_words (
+      &__vectors_start, (uint32_t*)ram_vectors,
+      (uint32_t*)ram_vectors + copied);
+
+  // The device table may be shorter; an interrupt without a vector
+  // must not jump to a random address.
+  for (uint32_t i = copied; i < CORTEXM_ARCHITECTURE_VECTORS_COUNT; ++i)
+    {
+      ram_vectors[i] = Default_Handler;
+    }
+
+  // The table is complete before the first vector fetch from it.
+  cortexm_architecture_dsb ();
+  CORTEXM_ARCHITECTURE_SCB_VTOR = (uint32_t)ram_vectors;
+  cortexm_architecture_dsb ();
+  cortexm_architecture_isb ();
+}
+
+// Usually defined by the device startup code, for the unused vectors.
+void __attribute__ ((weak))
+Default_Handler (void)
+{
+  // Wait for the debugger or the watchdog.
+  while (true)
+    {
+      cortexm_architecture_wfi ();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS)
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,114 @@
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+# Run a performance image, save its results as JSON and compare them
+# with the baseline; invoked by ctest with `cmake -P`:
+#
+# - RUN_COMMAND: the command to run the image, with `|` separators
+# - IMAGE: the image to run
+# - NAME: the variant name, used for the file names
+# - RESULTS_DIR: where to write `<NAME>.json`
+# - BASELINE_DIR: where to find the reference `<NAME>.json`
+# - TOLERANCE: the accepted increase, in percent
+# - UPDATE_BASELINE: if true, copy the results over the baseline
+
+# -----------------------------------------------------------------------------
+
+cmake_minimum_required(VERSION 3.20)
+
+string(REPLACE "|" ";" run_command "${RUN_COMMAND}")
+
+execute_process(
+  COMMAND ${run_command} "${IMAGE}"
+  RESULT_VARIABLE result
+  OUTPUT_VARIABLE output
+  ERROR_VARIABLE error
+  TIMEOUT 120
+)
+
+message("${output}${error}")
+
+if(NOT "${result}" STREQUAL "0")
+  message(FATAL_ERROR "${NAME}: the image failed (${result})")
+endif()
+
+string(REGEX MATCH "MICRO_OS_PLUS_PERF ([^\n]*)" match "${output}")
+if("${match}" STREQUAL "")
+  message(FATAL_ERROR "${NAME}: no MICRO_OS_PLUS_PERF line in the output")
+endif()
+set(results "${CMAKE_MATCH_1}")
+
+# Validate the JSON before saving it.
+string(JSON count ERROR_VARIABLE json_error LENGTH "${results}")
+if(json_error)
+  message(FATAL_ERROR "${NAME}: ${json_error}")
+endif()
+
+file(MAKE_DIRECTORY "${RESULTS_DIR}")
+file(WRITE "${RESULTS_DIR}/${NAME}.json" "${results}\n")
+
+set(baseline_file "${BASELINE_DIR}/${NAME}.json")
+
+if(UPDATE_BASELINE)
+  file(MAKE_DIRECTORY "${BASELINE_DIR}")
+  file(WRITE "${baseline_file}" "${results}\n")
+  message(STATUS "${NAME}: baseline updated")
+  return()
+endif()
+
+# Without a baseline nothing can be checked; the test is reported as
+# skipped (by SKIP_REGULAR_EXPRESSION), not passed, until it is
+# recorded.
+if(NOT EXISTS "${baseline_file}")
+  message("${NAME}: no baseline in ${BASELINE_DIR}, skipped; "
+    "record it with -D PERF_UPDATE_BASELINE=ON and commit it")
+  return()
+endif()
+
+file(READ "${baseline_file}" baseline)
+
+# Compare all numeric members; an increase beyond the tolerance
+# is a regression.
+set(regressions 0)
+math(EXPR last "${count} - 1")
+foreach(index RANGE ${last})
+  string(JSON key MEMBER "${results}" ${index})
+  string(JSON type TYPE "${results}" "${key}")
+  if(NOT "${type}" STREQUAL "NUMBER")
+    continue()
+  endif()
+
+  string(JSON value GET "${results}" "${key}")
+  string(JSON reference ERROR_VARIABLE missing GET "${baseline}" "${key}")
+  if(missing)
+    message(STATUS "${NAME}: ${key} = ${value} (new)")
+    continue()
+  endif()
+
+  math(EXPR limit "${reference} + (${reference} * ${TOLERANCE}) / 100")
+  if(value GREATER limit)
+    message(STATUS "${NAME}: ${key} = ${value}, baseline ${reference} (REGRESSION)")
+    math(EXPR regressions "${regressions} + 1")
+  elseif(value LESS reference)
+    message(STATUS "${NAME}: ${key} = ${value}, baseline ${reference} (improved)")
+  else()
+    message(STATUS "${NAME}: ${key} = ${value}, baseline ${reference}")
+  endif()
+endforeach()
+
+if(regressions GREATER 0)
+  message(FATAL_ERROR "${NAME}: ${regressions} regression(s)")
+endif()
+
+# -----------------------------------------------------------------------------
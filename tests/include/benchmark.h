@@ -0,0 +1,123 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_TESTS_BENCHMARK_H_
+#define MICRO_OS_PLUS_TESTS_BENCHMARK_H_
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// ----------------------------------------------------------------------------
+
+namespace micro_os_plus::benchmark
+{
+  // --------------------------------------------------------------------------
+
+  /**
+   * The function being measured; the context is passed unchanged.
+   */
+  using kernel_t = void (*) (void* context);
+
+  /**
+   * The statistics for one kernel, in cycles, with the
+   * measurement overhead already subtracted.
+   */
+  struct result_t
+  {
+    const char* name;
+    uint32_t iterations;
+    uint32_t min;
+    uint32_t median;
+    uint32_t max;
+  };
+
+  /**
+   * A statically allocated set of kernels, each timed with the
+   * architecture cycle counter.
+   */
+  class runner
+  {
+  public:
+    static constexpr std::size_t max_kernels = 32;
+    static constexpr std::size_t max_iterations = 256;
+
+    runner ();
+
+    runner (const runner&) = delete;
+    runner (runner&&) = delete;
+    runner&
+    operator= (const runner&)
+        = delete;
+    runner&
+    operator= (runner&&)
+        = delete;
+
+    ~runner () = default;
+
+    /**
+     * Register a kernel; return false if there is no more space.
+     */
+    bool
+    add (const char* name, kernel_t kernel, void* context = nullptr);
+
+    /**
+     * Run each kernel `iterations` times (at most max_iterations),
+     * print the report and return the number of kernels run.
+     */
+    std::size_t
+    run (uint32_t iterations);
+
+    /**
+     * The statistics of the i-th kernel, valid after run().
+     */
+    const result_t&
+    result (std::size_t index) const;
+
+    std::size_t
+    size (void) const;
+
+    /**
+     * The cost of reading the counter, as measured at construction.
+     */
+    uint32_t
+    overhead (void) const;
+
+  protected:
+    uint32_t
+    measure (kernel_t kernel, void* context);
+
+    struct entry_t
+    {
+      kernel_t kernel;
+      void* context;
+    };
+
+    entry_t entries_[max_kernels];
+    result_t results_[max_kernels];
+    std::size_t size_ = 0;
+
+    uint32_t samples_[max_iterations];
+    uint32_t overhead_ = 0;
+  };
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::benchmark
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_TESTS_BENCHMARK_H_
+
+// ----------------------------------------------------------------------------
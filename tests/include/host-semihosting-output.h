@@ -0,0 +1,94 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_TESTS_HOST_SEMIHOSTING_OUTPUT_H_
+#define MICRO_OS_PLUS_TESTS_HOST_SEMIHOSTING_OUTPUT_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// `src/semihosting-output.c` on the build machine.
+//
+// The console is opened by the synthetic backend; the SYS_WRITE calls
+// are captured instead of being passed to it. The hooks run in the
+// place of a handler which preempts the code, once inside the next
+// SYS_WRITE, or after each critical section.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  typedef void (*host_semihosting_output_hook_t) (void);
+
+  /**
+   * Empty the ring, forget the console and the counters, clear the
+   * hooks and the captured bytes.
+   */
+  void
+  host_semihosting_output_reset (void);
+
+  /**
+   * Fail the next opens of the console, like before the debugger is
+   * ready.
+   */
+  void
+  host_semihosting_output_fail_opens (uint32_t count);
+
+  void
+  host_semihosting_output_on_write (host_semihosting_output_hook_t hook);
+
+  /**
+   * Not called again for the critical sections of the hook itself.
+   */
+  void
+  host_semihosting_output_on_critical_exit (
+      host_semihosting_output_hook_t hook);
+
+  /**
+   * The bytes passed to the host since the reset.
+   */
+  const char*
+  host_semihosting_output_captured (size_t* size);
+
+  /**
+   * The bytes in the ring.
+   */
+  uint32_t
+  host_semihosting_output_used (void);
+
+  uint32_t
+  host_semihosting_output_opens (void);
+
+  uint32_t
+  host_semihosting_output_writes (void);
+
+  /**
+   * The most SYS_WRITE calls in progress at the same time.
+   */
+  uint32_t
+  host_semihosting_output_nesting (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_TESTS_HOST_SEMIHOSTING_OUTPUT_H_
+
+// ----------------------------------------------------------------------------
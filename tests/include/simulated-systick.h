@@ -0,0 +1,87 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_TESTS_SIMULATED_SYSTICK_H_
+#define MICRO_OS_PLUS_TESTS_SIMULATED_SYSTICK_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ----------------------------------------------------------------------------
+// A simulated SysTick, to run `src/tickless.c` on the build machine.
+//
+// The time is counted in core cycles; each access to the SysTick
+// registers or to ICSR takes one, and SysTick counts once every
+// `divider` cycles, so with a divider above 1 the code sees the
+// same value, including the 0 at the end of a period, more than
+// once. When the interrupt is pending and PRIMASK is clear, the
+// tickless handler runs before the next access, like a preemption.
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  /**
+   * Disable SysTick and set the clock divider; the tickless state is
+   * reset by `cortexm_architecture_tickless_initialize()`.
+   */
+  void
+  simulated_systick_reset (uint32_t divider);
+
+  /**
+   * Let the given number of cycles pass, then run the handler if
+   * allowed. Periods which end in the same call are lost, as with a
+   * starved handler.
+   */
+  void
+  simulated_systick_advance (uint64_t cycles);
+
+  /**
+   * The cycles until the counter reaches 0.
+   */
+  uint64_t
+  simulated_systick_cycles_to_end (void);
+
+  /**
+   * The SysTick clocks since it was enabled; the first one is the
+   * reload which starts the tickless clock.
+   */
+  uint64_t
+  simulated_systick_clocks (void);
+
+  bool
+  simulated_systick_pending (void);
+
+  /**
+   * The handler runs, and how many of them found the deadline
+   * expired.
+   */
+  uint32_t
+  simulated_systick_interrupts (void);
+
+  uint32_t
+  simulated_systick_expirations (void);
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_TESTS_SIMULATED_SYSTICK_H_
+
+// ----------------------------------------------------------------------------
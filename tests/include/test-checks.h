@@ -0,0 +1,59 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_TESTS_TEST_CHECKS_H_
+#define MICRO_OS_PLUS_TESTS_TEST_CHECKS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+
+// ----------------------------------------------------------------------------
+// Minimal checks for the unit tests, without a framework; a failed
+// check is reported and the test continues, and `result()` gives the
+// exit code.
+
+namespace micro_os_plus::test
+{
+  // --------------------------------------------------------------------------
+
+  inline int failures = 0;
+
+  inline void
+  check (bool condition, const char* expression, const char* file, int line)
+  {
+    if (!condition)
+      {
+        std::printf ("%s:%d: check failed: %s\n", file, line, expression);
+        ++failures;
+      }
+  }
+
+  inline int
+  result (const char* name)
+  {
+    std::printf ("%s: %s\n", name, (failures == 0) ? "passed" : "FAILED");
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::test
+
+#define MICRO_OS_PLUS_TEST_CHECK(condition) \
+  ::micro_os_plus::test::check ((condition), #condition, __FILE__, __LINE__)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_TESTS_TEST_CHECKS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+#ifndef MICRO_OS_PLUS_TESTS_STARTUP_TIMESTAMPS_H_
+#define MICRO_OS_PLUS_TESTS_STARTUP_TIMESTAMPS_H_
+
+// ----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif // defined(__cplusplus)
+
+  // --------------------------------------------------------------------------
+
+  /**
+   * Raw SysTick values (a 24-bit down counter) taken by the startup
+   * code; kept in .noinit, since they are taken before the RAM
+   * is initialised.
+   */
+  typedef struct startup_timestamps_s
+  {
+    uint32_t reset;
+    uint32_t data_initialised;
+    uint32_t bss_initialised;
+  } startup_timestamps_t;
+
+  extern startup_timestamps_t startup_timestamps;
+
+  /**
+   * The number of SysTick ticks between two raw values, assuming
+   * less than one full 24-bit period.
+   */
+  static inline uint32_t
+  startup_timestamps_elapsed (uint32_t begin, uint32_t end)
+  {
+    return (begin - end) & 0x00FFFFFFUL;
+  }
+
+  // --------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+}
+#endif // defined(__cplusplus)
+
+// ----------------------------------------------------------------------------
+
+#endif // MICRO_OS_PLUS_TESTS_STARTUP_TIMESTAMPS_H_
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+// A minimal startup for the QEMU MPS2 and micro:bit boards; it records
+// SysTick timestamps of the startup steps, used by the performance
+// tests.
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/exception-handlers.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <startup-timestamps.h>
+
+#include <stdlib.h>
+
+// ----------------------------------------------------------------------------
+
+// Defined by the linker scripts.
+extern uint32_t __stack;
+
+// Newlib & librdimon.
+extern void
+__libc_init_array (void);
+extern void
+initialise_monitor_handles (void);
+
+extern int
+main (int argc, char* argv[]);
+
+__attribute__ ((section (".noinit"))) startup_timestamps_t startup_timestamps;
+
+// ----------------------------------------------------------------------------
+
+void __attribute__ ((noreturn))
+Default_Handler (void);
+
+void __attribute__ ((weak, alias ("Default_Handler")))
+NMI_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+HardFault_Handler (void);
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+void __attribute__ ((weak, alias ("Default_Handler")))
+MemManage_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+BusFault_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+UsageFault_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+DebugMon_Handler (void);
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+void __attribute__ ((weak, alias ("Default_Handler")))
+SVC_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+PendSV_Handler (void);
+void __attribute__ ((weak, alias ("Default_Handler")))
+SysTick_Handler (void);
+
+__attribute__ ((section (".interrupt_vectors"), used))
+handler_ptr_t _interrupt_vectors[] = {
+  (handler_ptr_t)&__stack, // The initial stack pointer
+  Reset_Handler,
+  NMI_Handler,
+  HardFault_Handler,
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  MemManage_Handler,
+  BusFault_Handler,
+  UsageFault_Handler,
+#else
+  0,
+  0,
+  0,
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  0,
+  0,
+  0,
+  0,
+  SVC_Handler,
+#if defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  DebugMon_Handler,
+#else
+  0,
+#endif // defined(CORTEXM_ARCHITECTURE_IS_MAINLINE)
+  0,
+  PendSV_Handler,
+  SysTick_Handler,
+};
+
+// ----------------------------------------------------------------------------
+
+void __attribute__ ((noreturn))
+Reset_Handler (void)
+{
+  // On ARMv8-M catch the main stack overflows from the beginning.
+  cortexm_architecture_startup_initialize_stack_limit ();
+  cortexm_architecture_stack_paint_main ();
+
+  // Start SysTick free running first, to time the entire startup;
+  // the cycle counter API keeps it as is later.
+  CORTEXM_ARCHITECTURE_SYST_RVR = CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+  CORTEXM_ARCHITECTURE_SYST_CVR = 0;
+  CORTEXM_ARCHITECTURE_SYST_CSR = CORTEXM_ARCHITECTURE_SYST_CSR_CLKSOURCE
+                                  | CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE;
+  startup_timestamps.reset = CORTEXM_ARCHITECTURE_SYST_CVR;
+
+#if defined(__ARM_FP)
+  // Enable the FPU before the compiler gets a chance to use it.
+  CORTEXM_ARCHITECTURE_SCB_CPACR |= CORTEXM_ARCHITECTURE_SCB_CPACR_CP10_CP11_FULL;
+  __asm__ volatile(" dsb \n isb \n" : : : "memory");
+#endif // defined(__ARM_FP)
+
+  cortexm_architecture_startup_initialize_data ();
+  startup_timestamps.data_initialised = CORTEXM_ARCHITECTURE_SYST_CVR;
+
+  cortexm_architecture_startup_initialize_bss ();
+  startup_timestamps.bss_initialised = CORTEXM_ARCHITECTURE_SYST_CVR;
+
+  // With MICRO_OS_PLUS_ARCHITECTURE_RAM_VECTORS, fetch the vectors
+  // from RAM.
+  cortexm_architecture_startup_initialize_vectors ();
+
+  initialise_monitor_handles ();
+  __libc_init_array ();
+
+  int status = main (0, NULL);
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  cortexm_architecture_semihosting_output_flush_synchronous ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  exit (status);
+}
+
+void __attribute__ ((noreturn))
+Default_Handler (void)
+{
+  // Unexpected exception; report it and terminate the simulation,
+  // instead of hanging the test.
+#if defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  cortexm_architecture_semihosting_output_flush_synchronous ();
+#endif // defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+  micro_os_plus_semihosting_call_host (
+      MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0,
+      (micro_os_plus_semihosting_param_block_t*)"Unexpected exception\n");
+  micro_os_plus_semihosting_call_host (
+      MICRO_OS_PLUS_SEMIHOSTING_SYS_EXIT,
+      (micro_os_plus_semihosting_param_block_t*)
+          MICRO_OS_PLUS_SEMIHOSTING_ADP_STOPPED_INTERNAL_ERROR);
+  while (1)
+    {
+      micro_os_plus_architecture_wfi ();
+    }
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Check `scripts/compress-data.py`: the LZ4 round trip, and the result
+on a synthetic ELF file with the sections-flash.ld layout.
+
+The file has a compressible .fast_text image, followed by code, then
+a compressible .data image and an incompressible .dtcm_data image, at
+the end of the flash; the .data savings must move .dtcm_data down,
+the .fast_text savings remain a hole before the code.
+"""
+
+import importlib.util
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+import unittest
+
+SCRIPTS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       '..', '..', 'scripts')
+SCRIPT = os.path.join(SCRIPTS, 'compress-data.py')
+
+sys.path.insert(0, SCRIPTS)
+spec = importlib.util.spec_from_file_location('compress_data', SCRIPT)
+compress_data = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(compress_data)
+
+from elf32 import Elf32, PT_LOAD  # noqa: E402
+
+# The flash content, by load address.
+VECTORS = 0x00000000
+MEM_INITS = 0x00000100
+FAST_TEXT = 0x00000200
+TEXT = 0x00000300
+DATA = 0x00000380
+DTCM_DATA = 0x00000780
+FLASH_END = 0x00000980
+
+# (name, address, load address, size)
+IMAGES = [
+    ('.data', 0x20000000, DATA, 0x400),
+    ('.fast_text', 0x00100000, FAST_TEXT, 0x100),
+    ('.dtcm_data', 0x20010000, DTCM_DATA, 0x200),
+]
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHT_STRTAB = 3
+
+# -----------------------------------------------------------------------------
+
+
+def make_images():
+    generator = random.Random(2023)
+
+    data = bytearray(0x400)
+    # A table with a few initialised entries and runs of zeros.
+    for index in range(0, 0x400, 0x40):
+        data[index:index + 8] = struct.pack('<II', index, 0xCAFE0000 + index)
+    fast_text = bytes([0x70, 0x47, 0x00, 0xBF] * 0x40)
+    dtcm_data = bytes(generator.randrange(256) for _ in range(0x200))
+    return [bytes(data), fast_text, dtcm_data]
+
+
+def make_elf(images):
+    """An ELF32 Arm file with one segment per flash area, like a
+    linker output, and the symbols used by the tool."""
+    flash = bytearray(b'\xFF' * FLASH_END)
+    flash[TEXT:TEXT + 0x80] = bytes([0x00, 0xBF] * 0x40)
+    for index, (_, address, load, size) in enumerate(IMAGES):
+        flash[load:load + size] = images[index]
+        struct.pack_into('<III', flash, MEM_INITS + 12 * index, load,
+                         address, address + size)
+
+    # (name, address, load address, size); the vectors segment
+    # includes .mem_inits.
+    segments = [
+        ('.vectors', VECTORS, VECTORS, FAST_TEXT),
+        (IMAGES[1][0], IMAGES[1][1], FAST_TEXT, 0x100),
+        ('.text', TEXT, TEXT, 0x80),
+        (IMAGES[0][0], IMAGES[0][1], DATA, 0x400),
+        (IMAGES[2][0], IMAGES[2][1], DTCM_DATA, 0x200),
+    ]
+
+    strtab = b'\0__data_regions_array_begin__\0__data_regions_array_end__\0'
+    names = [b'', b'.symtab', b'.strtab', b'.shstrtab'] \
+        + [name.encode() for (name, *_) in segments]
+    shstrtab = b''.join(name + b'\0' for name in names)
+    name_offsets = []
+    offset = 0
+    for name in names:
+        name_offsets.append(offset)
+        offset += len(name) + 1
+
+    phoff = 52
+    content_offset = phoff + 32 * len(segments)
+    content = bytearray()
+    program_headers = bytearray()
+    section_headers = bytearray(40)
+    for index, (name, address, load, size) in enumerate(segments):
+        offset = content_offset + len(content)
+        content += flash[load:load + size]
+        program_headers += struct.pack('<8I', PT_LOAD, offset, address, load,
+                                       size, size, 5, 4)
+        section_headers += struct.pack('<10I', name_offsets[4 + index],
+                                       SHT_PROGBITS, 2, address, offset,
+                                       size, 0, 0, 4, 0)
+
+    symtab = bytes(16)
+    symtab += struct.pack('<IIIBBH', 1, MEM_INITS, 0, 0, 0, 1)
+    symtab += struct.pack('<IIIBBH', 30, MEM_INITS + 12 * len(IMAGES), 0,
+                          0, 0, 1)
+    tables = []
+    for (index, table) in ((1, symtab), (2, strtab), (3, shstrtab)):
+        tables.append((index, content_offset + len(content), table))
+        content += table
+    # After the null section and those of the segments.
+    strtab_index = 1 + len(segments) + 1
+    for (index, offset, table) in tables:
+        if index == 1:
+            section_headers += struct.pack(
+                '<10I', name_offsets[index], SHT_SYMTAB, 0, 0, offset,
+                len(table), strtab_index, 0, 4, 16)
+        else:
+            section_headers += struct.pack(
+                '<10I', name_offsets[index], SHT_STRTAB, 0, 0, offset,
+                len(table), 0, 0, 1, 0)
+
+    shoff = content_offset + len(content)
+    shnum = len(section_headers) // 40
+    header = b'\x7fELF' + bytes([1, 1, 1]) + bytes(9)
+    header += struct.pack('<HHIIIIIHHHHHH', 2, 40, 1, 0, phoff, shoff, 0,
+                          52, 32, len(segments), 40, shnum, shnum - 1)
+    return bytes(header + program_headers + content + section_headers)
+
+
+def read_records(elf):
+    offset = elf.file_offset(MEM_INITS, physical=False)
+    return [struct.unpack_from('<III', elf.content, offset + 12 * index)
+            for index in range(len(IMAGES))]
+
+
+def load_image(binary, record):
+    """What the startup writes in RAM, from the flash binary."""
+    (load, region_begin, region_end) = record
+    size = region_end - region_begin
+    address = load & ~compress_data.DATA_COMPRESSED
+    if load & compress_data.DATA_COMPRESSED:
+        return compress_data.lz4_decompress(binary[address:], size)
+    return binary[address:address + size]
+
+
+class Lz4Tests(unittest.TestCase):
+
+    def check(self, data):
+        stream = compress_data.lz4_compress(data)
+        self.assertEqual(compress_data.lz4_decompress(stream, len(data)),
+                         data)
+        return stream
+
+    def test_empty(self):
+        self.assertEqual(self.check(b''), b'')
+
+    def test_short(self):
+        for size in range(1, 20):
+            self.check(bytes(range(size)))
+
+    def test_runs(self):
+        # Overlapping matches, with extended lengths.
+        self.assertLess(len(self.check(bytes(1000))), 16)
+        self.assertLess(len(self.check(b'\x55' * 70000)), 300)
+        self.check(b'ab' * 300 + b'c' + b'ab' * 300)
+
+    def test_long_literals(self):
+        generator = random.Random(1)
+        self.check(bytes(generator.randrange(256) for _ in range(300)))
+
+    def test_far_matches(self):
+        # Beyond the 16-bit offsets, the repetition is literals.
+        generator = random.Random(2)
+        block = bytes(generator.randrange(256) for _ in range(0x12000))
+        self.check(block + block)
+
+    def test_tables(self):
+        for image in make_images():
+            self.check(image)
+
+
+class CompressElfTests(unittest.TestCase):
+
+    def setUp(self):
+        self.images = make_images()
+        self.elf = Elf32(make_elf(self.images))
+        self.original = self.elf.binary()
+
+    def test_fixture(self):
+        self.assertEqual(len(self.original), FLASH_END)
+        for record, image in zip(read_records(self.elf), self.images):
+            self.assertEqual(load_image(self.original, record), image)
+
+    def test_compress(self):
+        saved = compress_data.compress_records(self.elf, False)
+        binary = self.elf.binary()
+
+        records = read_records(self.elf)
+        (data, fast_text, dtcm_data) = records
+        self.assertEqual(fast_text[0], FAST_TEXT | 1)
+        self.assertEqual(data[0], DATA | 1)
+        # Not compressed, moved down.
+        self.assertEqual(dtcm_data[0], DTCM_DATA - saved)
+
+        self.assertGreater(saved, 0x300)
+        self.assertEqual(len(binary), FLASH_END - saved)
+        for record, image in zip(records, self.images):
+            self.assertEqual(load_image(binary, record), image)
+
+        # The code did not move.
+        self.assertEqual(binary[TEXT:TEXT + 0x80],
+                         self.original[TEXT:TEXT + 0x80])
+
+        # The segments and the sections agree, for the tools which place
+        # the sections by segment.
+        sections = {section[4]: section for section in self.elf.sections()}
+        for _, (p_type, p_offset, _, p_paddr, p_filesz, p_memsz, *_) \
+                in self.elf.segments():
+            self.assertEqual(p_type, PT_LOAD)
+            self.assertEqual(p_filesz, p_memsz)
+            self.assertEqual(sections[p_offset][5], p_filesz)
+
+    def test_compress_again(self):
+        compress_data.compress_records(self.elf, False)
+        content = bytes(self.elf.content)
+        self.assertEqual(compress_data.compress_records(self.elf, False), 0)
+        self.assertEqual(bytes(self.elf.content), content)
+
+    def test_command_line(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'app.elf')
+            with open(path, 'wb') as file:
+                file.write(make_elf(self.images))
+
+            output = subprocess.run(
+                [sys.executable, SCRIPT, path, '-o',
+                 os.path.join(folder, 'out.elf'), '--binary',
+                 os.path.join(folder, 'out.bin'), '-v'],
+                check=True, capture_output=True, text=True).stdout
+            self.assertIn('bytes of flash saved', output)
+            self.assertIn('not compressed', output)
+
+            with open(os.path.join(folder, 'out.bin'), 'rb') as file:
+                binary = file.read()
+            with open(os.path.join(folder, 'out.elf'), 'rb') as file:
+                elf = Elf32(file.read())
+            self.assertLess(len(binary), FLASH_END - 0x300)
+            self.assertEqual(binary, elf.binary())
+
+# -----------------------------------------------------------------------------
+
+
+if __name__ == '__main__':
+    unittest.main()
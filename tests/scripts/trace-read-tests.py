@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+#
+# This file is part of the µOS++ distribution.
+#   (https://github.com/micro-os-plus/)
+# Copyright (c) 2023 Liviu Ionescu
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose is hereby granted, under the terms of the MIT license.
+#
+# If a copy of the license was not distributed with this file, it can
+# be obtained from https://opensource.org/licenses/MIT/.
+#
+# -----------------------------------------------------------------------------
+
+"""
+Check `scripts/trace-read.py` against a synthetic RAM image.
+
+The image has a copy of the identifier at an unaligned offset, which
+must be skipped, followed by a control block with one up channel,
+whose unread bytes wrap around the end of its buffer, and one down
+channel.
+"""
+
+import importlib.util
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import unittest
+
+SCRIPTS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       '..', '..', 'scripts')
+SCRIPT = os.path.join(SCRIPTS, 'trace-read.py')
+
+sys.path.insert(0, SCRIPTS)
+spec = importlib.util.spec_from_file_location('trace_read', SCRIPT)
+trace_read = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(trace_read)
+
+BASE = 0x20000000
+DECOY = 0x0002
+CONTROL = 0x0040
+NAME = 0x0100
+UP_BUFFER = 0x0200
+DOWN_BUFFER = 0x0300
+
+# -----------------------------------------------------------------------------
+
+
+def make_image():
+    content = bytearray(0x400)
+
+    decoy = trace_read.DEFAULT_ID + b'\0'
+    content[DECOY:DECOY + len(decoy)] = decoy
+
+    name = b'Terminal\0'
+    content[NAME:NAME + len(name)] = name
+
+    # 16 bytes, read at 12, written at 4: 'WXYZ' then 'abcd'.
+    content[UP_BUFFER:UP_BUFFER + 16] = b'abcd........WXYZ'
+
+    block = trace_read.HEADER.pack(trace_read.DEFAULT_ID, 1, 1)
+    block += trace_read.CHANNEL.pack(BASE + NAME, BASE + UP_BUFFER, 16,
+                                     4, 12, 2)
+    block += trace_read.CHANNEL.pack(0, BASE + DOWN_BUFFER, 8, 0, 0, 0)
+    content[CONTROL:CONTROL + len(block)] = block
+
+    return bytes(content)
+
+
+class TraceReadTests(unittest.TestCase):
+
+    def setUp(self):
+        self.image = trace_read.Image(make_image(), BASE)
+
+    def test_find_skips_unaligned(self):
+        address = trace_read.find_control(self.image, None,
+                                          trace_read.DEFAULT_ID)
+        self.assertEqual(address, BASE + CONTROL)
+
+    def test_find_missing(self):
+        image = trace_read.Image(bytes(64), BASE)
+        with self.assertRaises(ValueError):
+            trace_read.find_control(image, None, trace_read.DEFAULT_ID)
+
+    def test_find_only_unaligned(self):
+        content = bytearray(64)
+        content[1:12] = trace_read.DEFAULT_ID + b'\0'
+        image = trace_read.Image(bytes(content), BASE)
+        with self.assertRaises(ValueError):
+            trace_read.find_control(image, None, trace_read.DEFAULT_ID)
+
+    def test_channels(self):
+        (identifier, up, down) = trace_read.read_channels(self.image,
+                                                          BASE + CONTROL)
+        self.assertEqual(identifier, trace_read.DEFAULT_ID)
+        self.assertEqual(len(up), 1)
+        self.assertEqual(len(down), 1)
+        self.assertEqual(self.image.string(up[0][0], None), 'Terminal')
+        self.assertEqual(self.image.string(down[0][0], None), '')
+
+    def test_unread(self):
+        (_, up, down) = trace_read.read_channels(self.image, BASE + CONTROL)
+        self.assertEqual(trace_read.unread(self.image, up[0]), b'WXYZabcd')
+        self.assertEqual(trace_read.unread(self.image, down[0]), b'')
+
+        # Not wrapped.
+        channel = (0, BASE + UP_BUFFER, 16, 4, 0, 0)
+        self.assertEqual(trace_read.unread(self.image, channel), b'abcd')
+
+        # Corrupted offsets are ignored.
+        channel = (0, BASE + UP_BUFFER, 16, 16, 0, 0)
+        self.assertEqual(trace_read.unread(self.image, channel), b'')
+
+    def test_command_line(self):
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'ram.bin')
+            with open(path, 'wb') as file:
+                file.write(make_image())
+
+            output = subprocess.run(
+                [sys.executable, SCRIPT, path, '--base', hex(BASE)],
+                check=True, capture_output=True).stdout
+            self.assertEqual(output, b'WXYZabcd')
+
+            output = subprocess.run(
+                [sys.executable, SCRIPT, path, '--base', hex(BASE), '-l'],
+                check=True, capture_output=True, text=True).stdout
+            self.assertIn('up 0 "Terminal"', output)
+            self.assertIn('block', output)
+
+# -----------------------------------------------------------------------------
+
+
+if __name__ == '__main__':
+    unittest.main()
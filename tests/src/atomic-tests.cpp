@@ -0,0 +1,157 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <test-checks.h>
+
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace atomic = micro_os_plus::architecture::atomic;
+
+  constexpr int threads_count = 4;
+  constexpr uint32_t iterations = 100000;
+
+  void
+  test_c_api (void)
+  {
+    volatile uint32_t value = 10;
+
+    uint32_t expected = 10;
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_compare_exchange (&value, &expected,
+                                                            20));
+    MICRO_OS_PLUS_TEST_CHECK (value == 20);
+
+    // On failure, the current value is returned in `expected`.
+    expected = 10;
+    MICRO_OS_PLUS_TEST_CHECK (
+        !micro_os_plus_architecture_atomic_compare_exchange (&value, &expected,
+                                                             30));
+    MICRO_OS_PLUS_TEST_CHECK (expected == 20);
+    MICRO_OS_PLUS_TEST_CHECK (value == 20);
+
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_exchange (&value, 5) == 20);
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_fetch_add (&value, 3) == 5);
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_fetch_sub (&value, 1) == 8);
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_fetch_or (&value, 0xF0) == 7);
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_fetch_and (&value, 0x0F) == 0xF7);
+    MICRO_OS_PLUS_TEST_CHECK (value == 0x07);
+
+    // Wraps around.
+    value = 0;
+    MICRO_OS_PLUS_TEST_CHECK (
+        micro_os_plus_architecture_atomic_fetch_sub (&value, 1) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (value == UINT32_MAX);
+  }
+
+  template <typename T>
+  void
+  test_cpp_api (void)
+  {
+    volatile T value = 0;
+    T all_ones = static_cast<T> (~static_cast<T> (0));
+
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_sub (&value, T{ 1 }) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (value == all_ones);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_add (&value, T{ 2 }) == all_ones);
+    MICRO_OS_PLUS_TEST_CHECK (value == 1);
+
+    T expected = 0;
+    MICRO_OS_PLUS_TEST_CHECK (!atomic::compare_exchange (&value, expected,
+                                                         T{ 7 }));
+    MICRO_OS_PLUS_TEST_CHECK (expected == 1);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::compare_exchange (&value, expected,
+                                                        T{ 7 }));
+    MICRO_OS_PLUS_TEST_CHECK (value == 7);
+
+    MICRO_OS_PLUS_TEST_CHECK (atomic::exchange (&value, T{ 0x30 }) == 7);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_or (&value, T{ 0x03 }) == 0x30);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_and (&value, T{ 0x0F }) == 0x33);
+    MICRO_OS_PLUS_TEST_CHECK (value == 0x03);
+
+    // Returns the previous value; the operation sees the current one.
+    MICRO_OS_PLUS_TEST_CHECK (
+        atomic::update (&value, [] (T v) { return static_cast<T> (v * 5); })
+        == 0x03);
+    MICRO_OS_PLUS_TEST_CHECK (value == 0x0F);
+  }
+
+  // Concurrent increments are not lost, including those done with
+  // `update()` on narrow types, which retries the compare and exchange.
+  void
+  test_contention (void)
+  {
+    volatile uint32_t counter = 0;
+    volatile uint16_t narrow = 0;
+    volatile uint8_t bits = 0;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t)
+      {
+        threads.emplace_back ([&counter, &narrow, &bits, t] {
+          for (uint32_t i = 0; i < iterations; ++i)
+            {
+              atomic::fetch_add (&counter, uint32_t{ 1 });
+              atomic::update (&narrow, [] (uint16_t v) {
+                return static_cast<uint16_t> (v + 1);
+              });
+            }
+          atomic::fetch_or (&bits, static_cast<uint8_t> (1u << t));
+        });
+      }
+    for (auto& thread : threads)
+      {
+        thread.join ();
+      }
+
+    MICRO_OS_PLUS_TEST_CHECK (counter == threads_count * iterations);
+    MICRO_OS_PLUS_TEST_CHECK (
+        narrow == static_cast<uint16_t> (threads_count * iterations));
+    MICRO_OS_PLUS_TEST_CHECK (bits == (1u << threads_count) - 1);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_c_api ();
+  test_cpp_api<uint8_t> ();
+  test_cpp_api<uint16_t> ();
+  test_cpp_api<uint32_t> ();
+  test_contention ();
+
+  return micro_os_plus::test::result ("atomic-tests");
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <benchmark.h>
+
+#include <cstdio>
+
+// ----------------------------------------------------------------------------
+
+namespace micro_os_plus::benchmark
+{
+  // --------------------------------------------------------------------------
+
+  namespace
+  {
+    // Used to calibrate the measurement overhead.
+    void
+    empty_kernel (void*)
+    {
+    }
+
+    // The arrays are small, an insertion sort avoids pulling
+    // in the library.
+    void
+    sort (uint32_t* array, std::size_t size)
+    {
+      for (std::size_t i = 1; i < size; ++i)
+        {
+          uint32_t value = array[i];
+          std::size_t j = i;
+          while (j > 0 && array[j - 1] > value)
+            {
+              array[j] = array[j - 1];
+              --j;
+            }
+          array[j] = value;
+        }
+    }
+  } // namespace
+
+  // --------------------------------------------------------------------------
+
+  runner::runner ()
+  {
+    micro_os_plus::architecture::cycles::enable ();
+
+    // Take the minimum of several runs of the empty kernel, as
+    // the lower bound of what a measurement costs.
+    overhead_ = measure (empty_kernel, nullptr);
+    for (int i = 0; i < 16; ++i)
+      {
+        uint32_t value = measure (empty_kernel, nullptr);
+        if (value < overhead_)
+          {
+            overhead_ = value;
+          }
+      }
+  }
+
+  bool
+  runner::add (const char* name, kernel_t kernel, void* context)
+  {
+    if (size_ >= max_kernels)
+      {
+        return false;
+      }
+
+    entries_[size_] = { kernel, context };
+    results_[size_] = { name, 0, 0, 0, 0 };
+    ++size_;
+
+    return true;
+  }
+
+  std::size_t
+  runner::run (uint32_t iterations)
+  {
+    if (iterations == 0)
+      {
+        iterations = 1;
+      }
+    else if (iterations > max_iterations)
+      {
+        iterations = max_iterations;
+      }
+
+    std::printf ("%-32s %10s %10s %10s %10s\n", "kernel", "iterations",
+                 "min", "median", "max");
+
+    for (std::size_t k = 0; k < size_; ++k)
+      {
+        for (uint32_t i = 0; i < iterations; ++i)
+          {
+            uint32_t value = measure (entries_[k].kernel, entries_[k].context);
+            samples_[i] = (value > overhead_) ? (value - overhead_) : 0;
+          }
+
+        sort (samples_, iterations);
+
+        result_t& r = results_[k];
+        r.iterations = iterations;
+        r.min = samples_[0];
+        r.median = samples_[iterations / 2];
+        r.max = samples_[iterations - 1];
+
+        std::printf ("%-32s %10u %10u %10u %10u\n", r.name,
+                     static_cast<unsigned int> (r.iterations),
+                     static_cast<unsigned int> (r.min),
+                     static_cast<unsigned int> (r.median),
+                     static_cast<unsigned int> (r.max));
+      }
+
+    return size_;
+  }
+
+  const result_t&
+  runner::result (std::size_t index) const
+  {
+    return results_[index];
+  }
+
+  std::size_t
+  runner::size (void) const
+  {
+    return size_;
+  }
+
+  uint32_t
+  runner::overhead (void) const
+  {
+    return overhead_;
+  }
+
+  uint32_t
+  runner::measure (kernel_t kernel, void* context)
+  {
+    uint32_t begin = micro_os_plus::architecture::cycles::read ();
+    kernel (context);
+    uint32_t end = micro_os_plus::architecture::cycles::read ();
+
+    // Unsigned arithmetic takes care of a single wrap.
+    return end - begin;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace micro_os_plus::benchmark
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,493 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+// The Cortex-M atomic operations, compiled for the build machine with
+// the instructions they use mocked; built once with
+// MICRO_OS_PLUS_TEST_EXCLUSIVE_ACCESS, for the LDREX/STREX loops, and
+// once without, for the ARMv6-M PRIMASK sequences.
+//
+// Not with <micro-os-plus/architecture.h>, which selects the synthetic
+// implementation.
+
+// Only for this file; the architecture sources linked with the test
+// are not compiled for a Cortex-M.
+#if defined(MICRO_OS_PLUS_TEST_EXCLUSIVE_ACCESS)
+#define CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+#endif
+
+#include <micro-os-plus/architecture-cortexm/atomic.h>
+
+#include <test-checks.h>
+
+#include <functional>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  struct
+  {
+    // The local exclusive monitor.
+    const volatile void* address;
+    bool open;
+
+    uint32_t loads;
+    uint32_t stores;
+    uint32_t failures;
+    uint32_t clears;
+    // The next store exclusive instructions which fail without a
+    // reason, as the architecture allows.
+    uint32_t spurious;
+
+    uint32_t primask;
+    uint32_t disables;
+
+    // Runs once, at the first place where an interrupt can be taken:
+    // after the next load exclusive, or when PRIMASK is cleared.
+    std::function<void (void)> handler;
+  } mock;
+
+  void
+  mock_reset (void)
+  {
+    mock = {};
+  }
+
+  void
+  mock_interrupt (void)
+  {
+    auto handler = mock.handler;
+    mock.handler = nullptr;
+    if (handler)
+      {
+        handler ();
+        // The exception return clears the monitor.
+        mock.open = false;
+      }
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  template <typename T>
+  T
+  mock_ldrex (volatile T* address)
+  {
+    ++mock.loads;
+    T value = *address;
+    mock.address = address;
+    mock.open = true;
+    mock_interrupt ();
+    return value;
+  }
+
+  template <typename T>
+  uint32_t
+  mock_strex (T value, volatile T* address)
+  {
+    ++mock.stores;
+    bool stored = mock.open && mock.address == address && mock.spurious == 0;
+    if (mock.spurious > 0)
+      {
+        --mock.spurious;
+      }
+    mock.open = false;
+    if (!stored)
+      {
+        ++mock.failures;
+        return 1;
+      }
+    *address = value;
+    return 0;
+  }
+
+  void
+  mock_clrex (void)
+  {
+    ++mock.clears;
+    mock.open = false;
+  }
+
+#else
+
+  void
+  mock_set_primask (uint32_t value)
+  {
+    mock.primask = value;
+    if (value == 0)
+      {
+        mock_interrupt ();
+      }
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+// The functions used by the atomic operations.
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+static uint32_t
+cortexm_architecture_ldrex (volatile uint32_t* address)
+{
+  return mock_ldrex (address);
+}
+
+static uint32_t
+cortexm_architecture_strex (uint32_t value, volatile uint32_t* address)
+{
+  return mock_strex (value, address);
+}
+
+static void
+cortexm_architecture_clrex (void)
+{
+  mock_clrex ();
+}
+
+namespace cortexm::architecture
+{
+  template <typename T>
+  T
+  ldrex (volatile T* address)
+  {
+    return mock_ldrex (address);
+  }
+
+  template <typename T>
+  uint32_t
+  strex (T value, volatile T* address)
+  {
+    return mock_strex (value, address);
+  }
+
+  void
+  clrex (void)
+  {
+    mock_clrex ();
+  }
+} // namespace cortexm::architecture
+
+#else
+
+static uint32_t
+cortexm_architecture_interrupts_get_primask (void)
+{
+  return mock.primask;
+}
+
+static void
+cortexm_architecture_interrupts_disable (void)
+{
+  ++mock.disables;
+  mock.primask = 1;
+}
+
+static void
+cortexm_architecture_interrupts_set_primask (uint32_t value)
+{
+  mock_set_primask (value);
+}
+
+namespace cortexm::architecture::interrupts
+{
+  uint32_t
+  primask (void)
+  {
+    return mock.primask;
+  }
+
+  void
+  primask (uint32_t value)
+  {
+    mock_set_primask (value);
+  }
+
+  void
+  disable (void)
+  {
+    ++mock.disables;
+    mock.primask = 1;
+  }
+} // namespace cortexm::architecture::interrupts
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+#include <micro-os-plus/architecture-cortexm/atomic-inlines.h>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace atomic = cortexm::architecture::atomic;
+
+  // A read-modify-write operation, and the value it stores.
+  struct operation_s
+  {
+    std::function<uint32_t (volatile uint32_t*)> run;
+    std::function<uint32_t (uint32_t)> result;
+  };
+
+  const operation_s c_operations[] = {
+    { [] (volatile uint32_t* object) {
+       return cortexm_architecture_atomic_exchange (object, 5);
+     },
+      [] (uint32_t) { return 5u; } },
+    { [] (volatile uint32_t* object) {
+       return cortexm_architecture_atomic_fetch_add (object, 3);
+     },
+      [] (uint32_t previous) { return previous + 3; } },
+    { [] (volatile uint32_t* object) {
+       return cortexm_architecture_atomic_fetch_sub (object, 300);
+     },
+      [] (uint32_t previous) { return previous - 300; } },
+    { [] (volatile uint32_t* object) {
+       return cortexm_architecture_atomic_fetch_or (object, 0xF0);
+     },
+      [] (uint32_t previous) { return previous | 0xF0; } },
+    { [] (volatile uint32_t* object) {
+       return cortexm_architecture_atomic_fetch_and (object, 0x0F);
+     },
+      [] (uint32_t previous) { return previous & 0x0F; } },
+  };
+
+  // Uncontended; one access each.
+  void
+  test_c_operations (void)
+  {
+    for (const auto& operation : c_operations)
+      {
+        mock_reset ();
+        volatile uint32_t object = 0x1234;
+        MICRO_OS_PLUS_TEST_CHECK (operation.run (&object) == 0x1234);
+        MICRO_OS_PLUS_TEST_CHECK (object == operation.result (0x1234));
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+        MICRO_OS_PLUS_TEST_CHECK (mock.loads == 1);
+        MICRO_OS_PLUS_TEST_CHECK (mock.stores == 1);
+        MICRO_OS_PLUS_TEST_CHECK (mock.failures == 0);
+        MICRO_OS_PLUS_TEST_CHECK (!mock.open);
+#else
+        MICRO_OS_PLUS_TEST_CHECK (mock.disables == 1);
+        MICRO_OS_PLUS_TEST_CHECK (mock.primask == 0);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+      }
+  }
+
+  // A handler which stores the object while the operation is in
+  // progress; its store is never lost.
+  void
+  test_c_interrupted (void)
+  {
+    for (const auto& operation : c_operations)
+      {
+        mock_reset ();
+        volatile uint32_t object = 0x1234;
+        mock.handler = [&object] () { object = 0x5678; };
+
+        uint32_t previous = operation.run (&object);
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+        // Retried with the handler value.
+        MICRO_OS_PLUS_TEST_CHECK (previous == 0x5678);
+        MICRO_OS_PLUS_TEST_CHECK (object == operation.result (0x5678));
+        MICRO_OS_PLUS_TEST_CHECK (mock.loads == 2);
+        MICRO_OS_PLUS_TEST_CHECK (mock.failures == 1);
+#else
+        // The handler runs after the operation.
+        MICRO_OS_PLUS_TEST_CHECK (previous == 0x1234);
+        MICRO_OS_PLUS_TEST_CHECK (object == 0x5678);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+        MICRO_OS_PLUS_TEST_CHECK (mock.handler == nullptr);
+      }
+  }
+
+  void
+  test_c_compare_exchange (void)
+  {
+    mock_reset ();
+    volatile uint32_t object = 10;
+    uint32_t expected = 10;
+    MICRO_OS_PLUS_TEST_CHECK (
+        cortexm_architecture_atomic_compare_exchange (&object, &expected, 20));
+    MICRO_OS_PLUS_TEST_CHECK (object == 20);
+
+    // Not equal; the monitor is released without a store.
+    mock_reset ();
+    expected = 10;
+    MICRO_OS_PLUS_TEST_CHECK (
+        !cortexm_architecture_atomic_compare_exchange (&object, &expected, 30));
+    MICRO_OS_PLUS_TEST_CHECK (expected == 20);
+    MICRO_OS_PLUS_TEST_CHECK (object == 20);
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    MICRO_OS_PLUS_TEST_CHECK (mock.stores == 0);
+    MICRO_OS_PLUS_TEST_CHECK (mock.clears == 1);
+    MICRO_OS_PLUS_TEST_CHECK (!mock.open);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+    // Changed by a handler after it was compared.
+    mock_reset ();
+    expected = 20;
+    mock.handler = [&object] () { object = 21; };
+    bool result
+        = cortexm_architecture_atomic_compare_exchange (&object, &expected, 30);
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    MICRO_OS_PLUS_TEST_CHECK (!result);
+    MICRO_OS_PLUS_TEST_CHECK (expected == 21);
+    MICRO_OS_PLUS_TEST_CHECK (object == 21);
+    MICRO_OS_PLUS_TEST_CHECK (mock.clears == 1);
+#else
+    MICRO_OS_PLUS_TEST_CHECK (result);
+    MICRO_OS_PLUS_TEST_CHECK (object == 21);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    // Stored again with the same value; the retry succeeds.
+    mock_reset ();
+    expected = 21;
+    mock.handler = [&object] () { object = 21; };
+    MICRO_OS_PLUS_TEST_CHECK (
+        cortexm_architecture_atomic_compare_exchange (&object, &expected, 40));
+    MICRO_OS_PLUS_TEST_CHECK (object == 40);
+    MICRO_OS_PLUS_TEST_CHECK (mock.failures == 1);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  }
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  // The store exclusive may fail for no visible reason.
+  void
+  test_c_spurious (void)
+  {
+    mock_reset ();
+    mock.spurious = 3;
+    volatile uint32_t object = 7;
+    MICRO_OS_PLUS_TEST_CHECK (cortexm_architecture_atomic_fetch_add (&object, 1)
+                              == 7);
+    MICRO_OS_PLUS_TEST_CHECK (object == 8);
+    MICRO_OS_PLUS_TEST_CHECK (mock.loads == 4);
+    MICRO_OS_PLUS_TEST_CHECK (mock.failures == 3);
+
+    mock_reset ();
+    mock.spurious = 2;
+    uint32_t expected = 8;
+    MICRO_OS_PLUS_TEST_CHECK (
+        cortexm_architecture_atomic_compare_exchange (&object, &expected, 9));
+    MICRO_OS_PLUS_TEST_CHECK (object == 9);
+    MICRO_OS_PLUS_TEST_CHECK (mock.loads == 3);
+  }
+
+#else
+
+  // Nested in a critical section; PRIMASK stays set, and the handler
+  // waits for it.
+  void
+  test_c_masked (void)
+  {
+    mock_reset ();
+    mock.primask = 1;
+    volatile uint32_t object = 7;
+    mock.handler = [&object] () { object = 100; };
+
+    MICRO_OS_PLUS_TEST_CHECK (cortexm_architecture_atomic_fetch_add (&object, 1)
+                              == 7);
+    MICRO_OS_PLUS_TEST_CHECK (object == 8);
+    MICRO_OS_PLUS_TEST_CHECK (mock.primask == 1);
+    MICRO_OS_PLUS_TEST_CHECK (mock.handler != nullptr);
+  }
+
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  // --------------------------------------------------------------------------
+
+  // The sub-word sizes use the exclusive accesses of their size.
+  template <typename T>
+  void
+  test_cpp (void)
+  {
+    T all_ones = static_cast<T> (~static_cast<T> (0));
+
+    mock_reset ();
+    volatile T object = 1;
+    mock.handler = [&object] () { object = 0; };
+    T previous = atomic::fetch_sub (&object, T{ 1 });
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    MICRO_OS_PLUS_TEST_CHECK (previous == 0);
+    MICRO_OS_PLUS_TEST_CHECK (object == all_ones);
+    MICRO_OS_PLUS_TEST_CHECK (mock.failures == 1);
+#else
+    MICRO_OS_PLUS_TEST_CHECK (previous == 1);
+    MICRO_OS_PLUS_TEST_CHECK (object == 0);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+    mock_reset ();
+    object = all_ones;
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_add (&object, T{ 2 }) == all_ones);
+    MICRO_OS_PLUS_TEST_CHECK (object == 1);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::exchange (&object, T{ 0x5A }) == 1);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_or (&object, T{ 0x0F }) == 0x5A);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::fetch_and (&object, T{ 0x3C }) == 0x5F);
+    MICRO_OS_PLUS_TEST_CHECK (object == 0x1C);
+
+    T expected = 0x1C;
+    mock.handler = [&object] () { object = 0x2D; };
+    bool result = atomic::compare_exchange (&object, expected, T{ 0x3E });
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+    MICRO_OS_PLUS_TEST_CHECK (!result);
+    MICRO_OS_PLUS_TEST_CHECK (expected == 0x2D);
+    MICRO_OS_PLUS_TEST_CHECK (!mock.open);
+    MICRO_OS_PLUS_TEST_CHECK (atomic::compare_exchange (&object, expected,
+                                                        T{ 0x3E }));
+#else
+    MICRO_OS_PLUS_TEST_CHECK (result);
+    MICRO_OS_PLUS_TEST_CHECK (mock.primask == 0);
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_c_operations ();
+  test_c_interrupted ();
+  test_c_compare_exchange ();
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  test_c_spurious ();
+#else
+  test_c_masked ();
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+
+  test_cpp<uint8_t> ();
+  test_cpp<uint16_t> ();
+  test_cpp<uint32_t> ();
+  test_cpp<int8_t> ();
+
+#if defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+  return micro_os_plus::test::result ("cortexm-atomic-exclusive-tests");
+#else
+  return micro_os_plus::test::result ("cortexm-atomic-primask-tests");
+#endif // defined(CORTEXM_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS)
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,172 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-output.h>
+
+#include <host-semihosting-output.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+static struct
+{
+  uint32_t failed_opens;
+  uint32_t opens;
+  uint32_t writes;
+  uint32_t depth;
+  uint32_t nesting;
+  bool in_hook;
+  host_semihosting_output_hook_t on_write;
+  host_semihosting_output_hook_t on_critical_exit;
+  size_t size;
+  char captured[8192];
+} host;
+
+// ----------------------------------------------------------------------------
+
+static micro_os_plus_semihosting_response_t
+host_call (int reason, micro_os_plus_semihosting_param_block_t* arg)
+{
+  switch (reason)
+    {
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_OPEN:
+      if (host.failed_opens > 0)
+        {
+          --host.failed_opens;
+          return -1;
+        }
+      ++host.opens;
+      break;
+
+    case MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE:
+      {
+        ++host.writes;
+        if (++host.depth > host.nesting)
+          {
+            host.nesting = host.depth;
+          }
+
+        size_t count = (size_t)arg[2];
+        if (count > sizeof (host.captured) - host.size)
+          {
+            count = sizeof (host.captured) - host.size;
+          }
+        memcpy (&host.captured[host.size], (const char*)(uintptr_t)arg[1],
+                count);
+        host.size += count;
+
+        host_semihosting_output_hook_t hook = host.on_write;
+        host.on_write = NULL;
+        if (hook != NULL)
+          {
+            hook ();
+          }
+
+        --host.depth;
+        // All bytes written.
+        return 0;
+      }
+
+    default:
+      break;
+    }
+
+  return micro_os_plus_semihosting_call_host (reason, arg);
+}
+
+static void
+host_critical_section_exit (cortexm_architecture_interrupts_status_t status)
+{
+  cortexm_architecture_interrupts_critical_section_exit (status);
+
+  if (host.on_critical_exit != NULL && !host.in_hook)
+    {
+      host.in_hook = true;
+      host.on_critical_exit ();
+      host.in_hook = false;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// The code under test, with the host calls and the end of the critical
+// sections redirected.
+
+#define micro_os_plus_semihosting_call_host host_call
+#define cortexm_architecture_interrupts_critical_section_exit \
+  host_critical_section_exit
+
+#include "../../src/semihosting-output.c"
+
+// ----------------------------------------------------------------------------
+
+void
+host_semihosting_output_reset (void)
+{
+  memset (&semihosting_output, 0, sizeof (semihosting_output));
+  memset (&host, 0, sizeof (host));
+}
+
+void
+host_semihosting_output_fail_opens (uint32_t count)
+{
+  host.failed_opens = count;
+}
+
+void
+host_semihosting_output_on_write (host_semihosting_output_hook_t hook)
+{
+  host.on_write = hook;
+}
+
+void
+host_semihosting_output_on_critical_exit (host_semihosting_output_hook_t hook)
+{
+  host.on_critical_exit = hook;
+}
+
+const char*
+host_semihosting_output_captured (size_t* size)
+{
+  *size = host.size;
+  return host.captured;
+}
+
+uint32_t
+host_semihosting_output_used (void)
+{
+  return semihosting_output.head - semihosting_output.tail;
+}
+
+uint32_t
+host_semihosting_output_opens (void)
+{
+  return host.opens;
+}
+
+uint32_t
+host_semihosting_output_writes (void)
+{
+  return host.writes;
+}
+
+uint32_t
+host_semihosting_output_nesting (void)
+{
+  return host.nesting;
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,36 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/stack.h>
+
+// ----------------------------------------------------------------------------
+// `src/stack.c`, which is not part of the synthetic architecture,
+// compiled for the build machine.
+
+// The linker script symbols; only used by the main stack functions,
+// which are not called.
+uint32_t __stack;
+uint32_t __stack_size;
+
+// These functions convert the 64-bit pointers to 32-bit addresses.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpointer-to-int-cast"
+#pragma GCC diagnostic ignored "-Wint-to-pointer-cast"
+
+#include "../../src/stack.c"
+
+#pragma GCC diagnostic pop
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,212 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <test-checks.h>
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS)
+#error "Build with MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS"
+#endif
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace irq_statistics = cortexm::architecture::irq_statistics;
+
+  constexpr uint32_t samples
+      = MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_SAMPLES;
+  constexpr uint32_t buckets
+      = MICRO_OS_PLUS_ARCHITECTURE_IRQ_STATISTICS_BUCKETS;
+
+  // With the default SHIFT of 4.
+  void
+  test_buckets (void)
+  {
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (0) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (1) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (31) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (32) == 1);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (63) == 1);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (64) == 2);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (1000) == 5);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (1u << 18)
+                              == buckets - 2);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (1u << 19)
+                              == buckets - 1);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::bucket (UINT32_MAX)
+                              == buckets - 1);
+  }
+
+  void
+  test_fold (void)
+  {
+    irq_statistics::reset ();
+
+    // IRQ 4; the counter wraps during the second run.
+    cortexm_architecture_irq_statistics_record (20, 100, 110);
+    cortexm_architecture_irq_statistics_record (20, UINT32_MAX - 49, 50);
+    cortexm_architecture_irq_statistics_record (20, 0, 1000);
+
+    irq_statistics::statistics_t statistics;
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (4, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == 3);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.min == 10);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.max == 1000);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.total == 1110);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.histogram[0] == 1);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.histogram[2] == 1);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.histogram[5] == 1);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.latency_count == 0);
+
+    // The latency is known only after a pend.
+    irq_statistics::pend (5);
+    uint32_t begin = cortexm_architecture_cycles_read ();
+    cortexm_architecture_irq_statistics_record (21, begin, begin + 7);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (5, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == 1);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.latency_count == 1);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.latency_total
+                              == statistics.latency_max);
+
+    // The pend time is used once.
+    cortexm_architecture_irq_statistics_record (21, begin, begin + 7);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (5, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == 2);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.latency_count == 1);
+
+    // On the host, the hooks account the runs to the exception 0.
+    {
+      irq_statistics::scope measured;
+    }
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (-16, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == 1);
+
+    MICRO_OS_PLUS_TEST_CHECK (!irq_statistics::snapshot (-17, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (!irq_statistics::snapshot (
+        CORTEXM_ARCHITECTURE_IRQ_STATISTICS_COUNT - 16, statistics));
+  }
+
+  void
+  test_dropped (void)
+  {
+    irq_statistics::reset ();
+
+    for (uint32_t i = 0; i < samples + 5; ++i)
+      {
+        cortexm_architecture_irq_statistics_record (16, 0, i);
+      }
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::dropped () == 5);
+
+    irq_statistics::statistics_t statistics;
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (0, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == samples);
+    MICRO_OS_PLUS_TEST_CHECK (statistics.max == samples - 1);
+
+    // Room again after the fold.
+    cortexm_architecture_irq_statistics_record (16, 0, 1);
+    irq_statistics::fold ();
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (0, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == samples + 1);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::dropped () == 5);
+
+    irq_statistics::reset ();
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::dropped () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (irq_statistics::snapshot (0, statistics));
+    MICRO_OS_PLUS_TEST_CHECK (statistics.count == 0);
+  }
+
+  void
+  test_format (void)
+  {
+    irq_statistics::statistics_t statistics{};
+    statistics.count = 4;
+    statistics.min = 10;
+    statistics.max = 90;
+    statistics.total = 200;
+    statistics.latency_count = 2;
+    statistics.latency_max = 7;
+    statistics.latency_total = 9;
+    statistics.histogram[0] = 3;
+    statistics.histogram[2] = 1;
+
+    const char* expected
+        = "MICRO_OS_PLUS_IRQ irq=-1 count=4 min=10 avg=50 max=90"
+          " latency_count=2 latency_avg=4 latency_max=7"
+          " histogram=3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0\n";
+
+    char line[CORTEXM_ARCHITECTURE_IRQ_STATISTICS_LINE_SIZE];
+    std::size_t length
+        = irq_statistics::format (-1, statistics, line, sizeof (line));
+    MICRO_OS_PLUS_TEST_CHECK (std::strcmp (line, expected) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (length == std::strlen (expected));
+
+    // Truncated, always terminated.
+    char small[10];
+    length = irq_statistics::format (-1, statistics, small, sizeof (small));
+    MICRO_OS_PLUS_TEST_CHECK (length == sizeof (small) - 1);
+    MICRO_OS_PLUS_TEST_CHECK (std::strcmp (small, "MICRO_OS_") == 0);
+
+    length = irq_statistics::format (-1, statistics, small, 0);
+    MICRO_OS_PLUS_TEST_CHECK (length == 0);
+
+    // The longest line fits exactly.
+    statistics.count = UINT32_MAX;
+    statistics.min = UINT32_MAX;
+    statistics.max = UINT32_MAX;
+    statistics.total = static_cast<uint64_t> (UINT32_MAX) * UINT32_MAX;
+    statistics.latency_count = UINT32_MAX;
+    statistics.latency_max = UINT32_MAX;
+    statistics.latency_total = statistics.total;
+    for (auto& bucket : statistics.histogram)
+      {
+        bucket = UINT32_MAX;
+      }
+    length = irq_statistics::format (INT32_MIN, statistics, line,
+                                     sizeof (line));
+    MICRO_OS_PLUS_TEST_CHECK (length == sizeof (line) - 1);
+    MICRO_OS_PLUS_TEST_CHECK (line[length - 1] == '\n');
+    MICRO_OS_PLUS_TEST_CHECK (
+        std::strncmp (line, "MICRO_OS_PLUS_IRQ irq=-2147483648 ", 34) == 0);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_buckets ();
+  test_fold ();
+  test_dropped ();
+  test_format ();
+
+  // Also via semihosting.
+  cortexm_architecture_irq_statistics_record (16, 0, 100);
+  irq_statistics::dump ();
+
+  return micro_os_plus::test::result ("irq-statistics-tests");
+}
+
+// ----------------------------------------------------------------------------
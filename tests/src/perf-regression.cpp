@@ -0,0 +1,163 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+// Measure the startup and a few architecture hot paths, and print
+// them as a single JSON line, prefixed by a marker; the runner script
+// extracts it into a file and compares it with the baseline.
+//
+// Under QEMU with `-icount` the counts are deterministic, which is
+// what a regression test needs; they are not real core cycles.
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+
+#include <startup-timestamps.h>
+
+#include <cstdio>
+
+// ----------------------------------------------------------------------------
+
+#if !defined(PLATFORM_CORE_NAME)
+#define PLATFORM_CORE_NAME "unknown"
+#endif
+
+#if !defined(PLATFORM_LAYOUT_NAME)
+#define PLATFORM_LAYOUT_NAME "unknown"
+#endif
+
+// Defined by the linker scripts.
+extern "C" uint8_t __vectors_start;
+extern "C" uint8_t _etext;
+extern "C" uint8_t __data_begin__;
+extern "C" uint8_t __data_end__;
+extern "C" uint8_t __bss_begin__;
+extern "C" uint8_t __bss_end__;
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  // Give the startup something to initialise, more than the
+  // library itself needs.
+  uint32_t initialised_data[1024] = { 1, 2, 3, 4 };
+  uint32_t uninitialised_data[4096];
+
+  volatile uint32_t exception_timestamp;
+
+  // The cheapest semihosting call with a side effect.
+  uint32_t
+  measure_semihosting_write0 (void)
+  {
+    static const char empty[] = "";
+
+    uint32_t begin = micro_os_plus::architecture::cycles::read ();
+    micro_os_plus_semihosting_call_host (
+        MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE0,
+        reinterpret_cast<micro_os_plus_semihosting_param_block_t*> (
+            const_cast<char*> (empty)));
+    return micro_os_plus::architecture::cycles::read () - begin;
+  }
+
+  // A line of text written to the console with one SYS_WRITE.
+  uint32_t
+  measure_semihosting_write (void)
+  {
+    static const char line[] = "perf: semihosting write probe\n";
+
+    micro_os_plus_semihosting_param_block_t block[3] = {
+      1, // stdout, as opened by librdimon
+      reinterpret_cast<micro_os_plus_semihosting_param_block_t> (line),
+      sizeof (line) - 1,
+    };
+
+    uint32_t begin = micro_os_plus::architecture::cycles::read ();
+    micro_os_plus_semihosting_call_host (MICRO_OS_PLUS_SEMIHOSTING_SYS_WRITE,
+                                         block);
+    return micro_os_plus::architecture::cycles::read () - begin;
+  }
+
+  // From setting PendSV pending to the first handler instruction.
+  uint32_t
+  measure_exception_entry (void)
+  {
+    uint32_t begin = micro_os_plus::architecture::cycles::read ();
+    CORTEXM_ARCHITECTURE_SCB_ICSR = CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSVSET;
+    __asm__ volatile(" dsb \n isb \n" : : : "memory");
+    return exception_timestamp - begin;
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+extern "C" void
+PendSV_Handler (void)
+{
+  exception_timestamp = micro_os_plus::architecture::cycles::read ();
+}
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  // Read the counter first, the rest of main() is not part of it.
+  uint32_t main_timestamp = CORTEXM_ARCHITECTURE_SYST_CVR;
+
+  uint32_t startup_to_main = startup_timestamps_elapsed (
+      startup_timestamps.reset, main_timestamp);
+  uint32_t data_copy = startup_timestamps_elapsed (
+      startup_timestamps.reset, startup_timestamps.data_initialised);
+  uint32_t bss_zero
+      = startup_timestamps_elapsed (startup_timestamps.data_initialised,
+                                    startup_timestamps.bss_initialised);
+
+  // Keep the arrays in the image.
+  __asm__ volatile(""
+                   :
+                   : "r"(initialised_data), "r"(uninitialised_data)
+                   : "memory");
+
+  micro_os_plus::architecture::cycles::enable ();
+
+  uint32_t semihosting_write0 = measure_semihosting_write0 ();
+  uint32_t semihosting_write = measure_semihosting_write ();
+  uint32_t exception_entry = measure_exception_entry ();
+
+  std::printf (
+      "MICRO_OS_PLUS_PERF {"
+      "\"core\": \"%s\", \"layout\": \"%s\", "
+      "\"text_bytes\": %u, \"data_bytes\": %u, \"bss_bytes\": %u, "
+      "\"startup_to_main\": %u, \"data_copy\": %u, \"bss_zero\": %u, "
+      "\"semihosting_write0\": %u, \"semihosting_write\": %u, "
+      "\"exception_entry\": %u}\n",
+      PLATFORM_CORE_NAME, PLATFORM_LAYOUT_NAME,
+      static_cast<unsigned int> (&_etext - &__vectors_start),
+      static_cast<unsigned int> (&__data_end__ - &__data_begin__),
+      static_cast<unsigned int> (&__bss_end__ - &__bss_begin__),
+      static_cast<unsigned int> (startup_to_main),
+      static_cast<unsigned int> (data_copy),
+      static_cast<unsigned int> (bss_zero),
+      static_cast<unsigned int> (semihosting_write0),
+      static_cast<unsigned int> (semihosting_write),
+      static_cast<unsigned int> (exception_entry));
+
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,238 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <test-checks.h>
+
+#include <thread>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  using micro_os_plus::architecture::spsc_ring_buffer;
+
+  // Starts with the indices near the top of their range, to check
+  // the wrap of the free running counters.
+  template <typename T, std::size_t N>
+  class wrapping_ring_buffer : public spsc_ring_buffer<T, N>
+  {
+  public:
+    explicit wrapping_ring_buffer (uint32_t start)
+    {
+      this->head_ = start;
+      this->tail_ = start;
+    }
+  };
+
+  void
+  test_single (void)
+  {
+    spsc_ring_buffer<uint32_t, 4> ring;
+
+    MICRO_OS_PLUS_TEST_CHECK (ring.capacity == 4);
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+    MICRO_OS_PLUS_TEST_CHECK (!ring.full ());
+
+    uint32_t value = 0;
+    MICRO_OS_PLUS_TEST_CHECK (!ring.pop (value));
+
+    for (uint32_t i = 1; i <= 4; ++i)
+      {
+        MICRO_OS_PLUS_TEST_CHECK (ring.push (i));
+      }
+    MICRO_OS_PLUS_TEST_CHECK (ring.full ());
+    MICRO_OS_PLUS_TEST_CHECK (ring.size () == 4);
+    MICRO_OS_PLUS_TEST_CHECK (!ring.push (5));
+
+    MICRO_OS_PLUS_TEST_CHECK (ring.pop (value) && value == 1);
+    MICRO_OS_PLUS_TEST_CHECK (ring.pop (value) && value == 2);
+
+    // Wraps around the end of the storage.
+    MICRO_OS_PLUS_TEST_CHECK (ring.push (5));
+    MICRO_OS_PLUS_TEST_CHECK (ring.push (6));
+    MICRO_OS_PLUS_TEST_CHECK (ring.full ());
+    for (uint32_t i = 3; i <= 6; ++i)
+      {
+        MICRO_OS_PLUS_TEST_CHECK (ring.pop (value) && value == i);
+      }
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+
+    ring.push (7);
+    ring.clear ();
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+  }
+
+  void
+  test_bulk (void)
+  {
+    wrapping_ring_buffer<uint8_t, 8> ring{ UINT32_MAX - 9 };
+
+    const uint8_t input[11] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    uint8_t output[11] = {};
+
+    // Truncated to the free space.
+    MICRO_OS_PLUS_TEST_CHECK (ring.push_n (input, 10) == 8);
+    MICRO_OS_PLUS_TEST_CHECK (ring.full ());
+
+    MICRO_OS_PLUS_TEST_CHECK (ring.pop_n (output, 3) == 3);
+    MICRO_OS_PLUS_TEST_CHECK (output[0] == 0 && output[2] == 2);
+
+    // The head index overflows to 1 here, and the copy is split.
+    MICRO_OS_PLUS_TEST_CHECK (ring.push_n (input + 8, 3) == 3);
+    MICRO_OS_PLUS_TEST_CHECK (ring.full ());
+
+    // Truncated to the available elements; also split.
+    MICRO_OS_PLUS_TEST_CHECK (ring.pop_n (output, 11) == 8);
+    for (uint8_t i = 0; i < 8; ++i)
+      {
+        MICRO_OS_PLUS_TEST_CHECK (output[i] == i + 3);
+      }
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+  }
+
+  void
+  test_spans (void)
+  {
+    spsc_ring_buffer<uint16_t, 8> ring;
+
+    auto span = ring.push_span ();
+    MICRO_OS_PLUS_TEST_CHECK (span.size () == 8);
+    for (std::size_t i = 0; i < 6; ++i)
+      {
+        span[i] = static_cast<uint16_t> (100 + i);
+      }
+    ring.push_commit (6);
+
+    auto data = ring.pop_span ();
+    MICRO_OS_PLUS_TEST_CHECK (data.size () == 6);
+    MICRO_OS_PLUS_TEST_CHECK (data[0] == 100 && data[5] == 105);
+    ring.pop_commit (5);
+
+    // The free space wraps; the first part ends at the storage end.
+    span = ring.push_span ();
+    MICRO_OS_PLUS_TEST_CHECK (span.size () == 2);
+    span[0] = 106;
+    span[1] = 107;
+    ring.push_commit (2);
+
+    // The second part, after the commit.
+    span = ring.push_span ();
+    MICRO_OS_PLUS_TEST_CHECK (span.size () == 5);
+    span[0] = 108;
+    ring.push_commit (1);
+
+    data = ring.pop_span ();
+    MICRO_OS_PLUS_TEST_CHECK (data.size () == 3);
+    MICRO_OS_PLUS_TEST_CHECK (data[0] == 105 && data[2] == 107);
+    ring.pop_commit (3);
+
+    data = ring.pop_span ();
+    MICRO_OS_PLUS_TEST_CHECK (data.size () == 1 && data[0] == 108);
+    ring.pop_commit (1);
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+    MICRO_OS_PLUS_TEST_CHECK (ring.pop_span ().empty ());
+  }
+
+  // A producer and a consumer thread, with single and bulk
+  // operations; the sequence must arrive complete and in order. The
+  // threads yield when blocked, not to spin for a whole time slice
+  // on a single core.
+  void
+  test_threads (void)
+  {
+    constexpr uint32_t count = 200000;
+    static wrapping_ring_buffer<uint32_t, 64> ring{ UINT32_MAX - 1000 };
+
+    std::thread producer{ [] {
+      uint32_t next = 0;
+      uint32_t block[5];
+      while (next < count)
+        {
+          uint32_t pushed;
+          if (next % 2 == 0)
+            {
+              pushed = ring.push (next) ? 1 : 0;
+            }
+          else
+            {
+              uint32_t n = std::min<uint32_t> (5, count - next);
+              for (uint32_t i = 0; i < n; ++i)
+                {
+                  block[i] = next + i;
+                }
+              pushed = ring.push_n (block, n);
+            }
+          if (pushed == 0)
+            {
+              std::this_thread::yield ();
+            }
+          next += pushed;
+        }
+    } };
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    uint32_t block[7];
+    while (expected < count)
+      {
+        uint32_t n = ring.pop_n (block, 7);
+        for (uint32_t i = 0; i < n; ++i)
+          {
+            ordered = ordered && (block[i] == expected);
+            ++expected;
+          }
+
+        uint32_t value;
+        if (ring.pop (value))
+          {
+            ordered = ordered && (value == expected);
+            ++expected;
+          }
+        else if (n == 0)
+          {
+            std::this_thread::yield ();
+          }
+      }
+
+    producer.join ();
+
+    MICRO_OS_PLUS_TEST_CHECK (ordered);
+    MICRO_OS_PLUS_TEST_CHECK (expected == count);
+    MICRO_OS_PLUS_TEST_CHECK (ring.empty ());
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_single ();
+  test_bulk ();
+  test_spans ();
+  test_threads ();
+
+  return micro_os_plus::test::result ("ring-buffer-tests");
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <benchmark.h>
+
+#include <cstdio>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  alignas (4) uint8_t source[256];
+  alignas (4) uint8_t destination[256];
+
+  void
+  nop_kernel (void*)
+  {
+    micro_os_plus::architecture::nop ();
+  }
+
+  void
+  memcpy_kernel (void* context)
+  {
+    std::size_t size = *static_cast<std::size_t*> (context);
+    std::memcpy (destination, source, size);
+    __asm__ volatile("" : : "r"(destination) : "memory");
+  }
+
+  void
+  memset_kernel (void* context)
+  {
+    std::size_t size = *static_cast<std::size_t*> (context);
+    std::memset (destination, 0, size);
+    __asm__ volatile("" : : "r"(destination) : "memory");
+  }
+
+  void
+  crc32_kernel (void*)
+  {
+    uint32_t crc = 0xFFFFFFFF;
+    for (std::size_t i = 0; i < 64; ++i)
+      {
+        crc ^= source[i];
+        for (int b = 0; b < 8; ++b)
+          {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+          }
+      }
+    __asm__ volatile("" : : "r"(crc));
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  static micro_os_plus::benchmark::runner runner;
+
+  static std::size_t small = 16;
+  static std::size_t large = sizeof (destination);
+
+  runner.add ("nop", nop_kernel);
+  runner.add ("memcpy-16", memcpy_kernel, &small);
+  runner.add ("memcpy-256", memcpy_kernel, &large);
+  runner.add ("memset-256", memset_kernel, &large);
+  runner.add ("crc32-64", crc32_kernel);
+
+  std::printf ("Counter overhead: %u cycles\n",
+               static_cast<unsigned int> (runner.overhead ()));
+
+  runner.run (64);
+
+  return 0;
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,227 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+#include <test-checks.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace semihosting = micro_os_plus::semihosting;
+
+  // In the folder where the test runs.
+  constexpr const char* path = "semihosting-file-tests.tmp";
+
+  constexpr size_t block_size = 64;
+
+  std::string
+  pattern (size_t size)
+  {
+    std::string content (size, '\0');
+    for (size_t i = 0; i < size; ++i)
+      {
+        content[i] = static_cast<char> ((i * 7 + i / 251) & 0xFF);
+      }
+    return content;
+  }
+
+  void
+  create (const std::string& content)
+  {
+    semihosting::handle_t handle
+        = semihosting::open (path, MICRO_OS_PLUS_SEMIHOSTING_OPEN_WB);
+    MICRO_OS_PLUS_TEST_CHECK (handle >= 0);
+    MICRO_OS_PLUS_TEST_CHECK (
+        semihosting::write (handle, content.data (), content.size ())
+        == content.size ());
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::close (handle) == 0);
+  }
+
+  semihosting::handle_t
+  open (void)
+  {
+    semihosting::handle_t handle
+        = semihosting::open (path, MICRO_OS_PLUS_SEMIHOSTING_OPEN_RB);
+    MICRO_OS_PLUS_TEST_CHECK (handle >= 0);
+    return handle;
+  }
+
+  // --------------------------------------------------------------------------
+
+  void
+  test_file (void)
+  {
+    std::string content = pattern (1000);
+    create (content);
+
+    semihosting::handle_t handle = open ();
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::length (handle) == 1000);
+
+    // In uneven pieces, up to the end.
+    std::string read;
+    char buffer[300];
+    size_t length;
+    while ((length = semihosting::read (handle, buffer, sizeof (buffer)))
+           > 0)
+      {
+        read.append (buffer, length);
+        if (length < sizeof (buffer))
+          {
+            break;
+          }
+      }
+    MICRO_OS_PLUS_TEST_CHECK (read == content);
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::read (handle, buffer, 10) == 0);
+
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::seek (handle, 100) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::read (handle, buffer, 50) == 50);
+    MICRO_OS_PLUS_TEST_CHECK (std::memcmp (buffer, &content[100], 50) == 0);
+
+    // Shorter at the end.
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::seek (handle, 990) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::read (handle, buffer, 50) == 10);
+    MICRO_OS_PLUS_TEST_CHECK (std::memcmp (buffer, &content[990], 10) == 0);
+
+    // The length does not depend on the position.
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::length (handle) == 1000);
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::close (handle) == 0);
+
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::length (handle) == -1);
+    MICRO_OS_PLUS_TEST_CHECK (
+        semihosting::open ("semihosting-file-tests.none",
+                           MICRO_OS_PLUS_SEMIHOSTING_OPEN_RB)
+        == -1);
+  }
+
+  // --------------------------------------------------------------------------
+
+  // Stream the file from the position, prefetching after each block if
+  // asked; the blocks alternate between the two buffers, and the
+  // prefetch does not change the block being processed.
+  std::string
+  stream (size_t size, size_t position, bool prefetch)
+  {
+    semihosting::handle_t handle = open ();
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::seek (handle, position) == 0);
+
+    alignas (4) char buffer0[block_size];
+    alignas (4) char buffer1[block_size];
+    semihosting::block_reader reader{ handle, buffer0, buffer1,
+                                      block_size };
+
+    std::string read;
+    const void* previous = nullptr;
+    size_t blocks = 0;
+    size_t length;
+    const void* block;
+    while ((block = reader.next (length)) != nullptr)
+      {
+        MICRO_OS_PLUS_TEST_CHECK (block == buffer0 || block == buffer1);
+        MICRO_OS_PLUS_TEST_CHECK (block != previous);
+        MICRO_OS_PLUS_TEST_CHECK (length > 0 && length <= block_size);
+        previous = block;
+        ++blocks;
+
+        std::string copy (static_cast<const char*> (block), length);
+        if (prefetch)
+          {
+            if (reader.prefetch ())
+              {
+                // Both buffers are in use.
+                MICRO_OS_PLUS_TEST_CHECK (!reader.prefetch ());
+              }
+            MICRO_OS_PLUS_TEST_CHECK (std::memcmp (block, copy.data (), length)
+                                      == 0);
+          }
+        read += copy;
+      }
+
+    // Stays at the end.
+    MICRO_OS_PLUS_TEST_CHECK (reader.next (length) == nullptr);
+    MICRO_OS_PLUS_TEST_CHECK (length == 0);
+    MICRO_OS_PLUS_TEST_CHECK (!reader.prefetch ());
+
+    size_t expected = (size - position + block_size - 1) / block_size;
+    MICRO_OS_PLUS_TEST_CHECK (blocks == expected);
+
+    MICRO_OS_PLUS_TEST_CHECK (semihosting::close (handle) == 0);
+    return read;
+  }
+
+  void
+  test_reader (size_t size)
+  {
+    std::string content = pattern (size);
+    create (content);
+
+    for (bool prefetch : { false, true })
+      {
+        MICRO_OS_PLUS_TEST_CHECK (stream (size, 0, prefetch) == content);
+        // The blocks no longer aligned to the file.
+        if (size > 30)
+          {
+            MICRO_OS_PLUS_TEST_CHECK (stream (size, 30, prefetch)
+                                      == content.substr (30));
+          }
+      }
+  }
+
+  void
+  test_reader_closed (void)
+  {
+    char buffer0[block_size];
+    char buffer1[block_size];
+    semihosting::block_reader reader{ -1, buffer0, buffer1, block_size };
+
+    size_t length = 1;
+    MICRO_OS_PLUS_TEST_CHECK (!reader.prefetch ());
+    MICRO_OS_PLUS_TEST_CHECK (reader.next (length) == nullptr);
+    MICRO_OS_PLUS_TEST_CHECK (length == 0);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_file ();
+
+  // Partial last block, a multiple of the block size, shorter than a
+  // block, and empty.
+  test_reader (5 * block_size + 17);
+  test_reader (4 * block_size);
+  test_reader (block_size - 1);
+  test_reader (0);
+  test_reader_closed ();
+
+  std::remove (path);
+
+  return micro_os_plus::test::result ("semihosting-file-tests");
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,246 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// Not part of the synthetic architecture; `src/semihosting-output.c`
+// runs with the host calls captured.
+#include <micro-os-plus/architecture-cortexm/semihosting-output.h>
+#include <micro-os-plus/architecture-cortexm/semihosting-output-inlines.h>
+
+#include <host-semihosting-output.h>
+#include <test-checks.h>
+
+#include <string>
+
+// ----------------------------------------------------------------------------
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT)
+#error "Build with MICRO_OS_PLUS_ARCHITECTURE_SEMIHOSTING_OUTPUT"
+#endif
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace output = cortexm::architecture::semihosting_output;
+
+  // The defaults.
+  constexpr size_t size = 1024;
+  constexpr size_t chunk = 32;
+
+  std::string
+  captured (void)
+  {
+    size_t count;
+    const char* bytes = host_semihosting_output_captured (&count);
+    return std::string (bytes, count);
+  }
+
+  void
+  write (const std::string& text, size_t expected)
+  {
+    MICRO_OS_PLUS_TEST_CHECK (output::write (text.data (), text.size ())
+                              == expected);
+  }
+
+  // Below the threshold the bytes stay in the ring; each contiguous
+  // block is one SYS_WRITE.
+  void
+  test_ring (void)
+  {
+    host_semihosting_output_reset ();
+
+    write ("hello", 5);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_used () == 5);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 0);
+
+    output::flush ();
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_used () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_opens () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (captured () == "hello");
+
+    // Nothing to do.
+    output::flush ();
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 1);
+
+    // Above the threshold, flushed by the write.
+    std::string text;
+    for (size_t i = 0; text.size () < size - 24 - 5; ++i)
+      {
+        text += static_cast<char> ('a' + i % 26);
+      }
+    write (text, text.size ());
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_used () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 2);
+
+    // Around the end of the ring, 24 bytes before it.
+    std::string wrapped (100, '*');
+    for (size_t i = 0; i < wrapped.size (); ++i)
+      {
+        wrapped[i] = static_cast<char> ('0' + i % 10);
+      }
+    write (wrapped, wrapped.size ());
+    output::flush ();
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 4);
+    MICRO_OS_PLUS_TEST_CHECK (captured () == "hello" + text + wrapped);
+
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_opens () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_nesting () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 0);
+  }
+
+  // A full ring is flushed by the writer, which continues.
+  void
+  test_full (void)
+  {
+    host_semihosting_output_reset ();
+
+    std::string text (size + 100, 'f');
+    write (text, text.size ());
+    output::flush ();
+    MICRO_OS_PLUS_TEST_CHECK (captured () == text);
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 0);
+  }
+
+  // --------------------------------------------------------------------------
+  // Long writes are copied in chunks, and a handler taken between them
+  // adds its bytes at the chunk boundaries.
+
+  void
+  handler_mark (void)
+  {
+    output::write ("|", 1);
+  }
+
+  void
+  test_chunks (void)
+  {
+    host_semihosting_output_reset ();
+    host_semihosting_output_on_critical_exit (handler_mark);
+
+    write (std::string (100, 'x'), 100);
+    host_semihosting_output_on_critical_exit (nullptr);
+    output::flush ();
+
+    std::string expected;
+    for (size_t left = 100; left > 0;)
+      {
+        size_t count = (left < chunk) ? left : chunk;
+        expected += std::string (count, 'x') + "|";
+        left -= count;
+      }
+    MICRO_OS_PLUS_TEST_CHECK (captured () == expected);
+  }
+
+  // --------------------------------------------------------------------------
+  // A handler which writes while the flush is in the host call does not
+  // flush; the owner continues up to the new head.
+
+  void
+  handler_above_threshold (void)
+  {
+    write (std::string (600, 'B'), 600);
+  }
+
+  void
+  test_ownership (void)
+  {
+    host_semihosting_output_reset ();
+
+    write (std::string (10, 'A'), 10);
+    host_semihosting_output_on_write (handler_above_threshold);
+    output::flush ();
+
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_nesting () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 2);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_used () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (captured ()
+                              == std::string (10, 'A')
+                                     + std::string (600, 'B'));
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 0);
+  }
+
+  // With the flush owned by the interrupted context, the bytes which
+  // do not fit are dropped.
+  void
+  handler_overflow (void)
+  {
+    // The 10 bytes being written still take space.
+    write (std::string (size + 100, 'C'), size - 10);
+  }
+
+  void
+  test_overflow (void)
+  {
+    host_semihosting_output_reset ();
+
+    write (std::string (10, 'A'), 10);
+    host_semihosting_output_on_write (handler_overflow);
+    output::flush ();
+
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_nesting () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 110);
+    MICRO_OS_PLUS_TEST_CHECK (captured ()
+                              == std::string (10, 'A')
+                                     + std::string (size - 10, 'C'));
+  }
+
+  // --------------------------------------------------------------------------
+
+  // The bytes drained while the console cannot be opened are counted;
+  // the open is retried by the next flush.
+  void
+  test_failed_open (void)
+  {
+    host_semihosting_output_reset ();
+    host_semihosting_output_fail_opens (1);
+
+    write ("lost", 4);
+    output::flush ();
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_used () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_opens () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_writes () == 0);
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 4);
+
+    write ("kept", 4);
+    output::flush_synchronous ();
+    MICRO_OS_PLUS_TEST_CHECK (host_semihosting_output_opens () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (captured () == "kept");
+    MICRO_OS_PLUS_TEST_CHECK (output::dropped () == 4);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_ring ();
+  test_full ();
+  test_chunks ();
+  test_ownership ();
+  test_overflow ();
+  test_failed_open ();
+
+  return micro_os_plus::test::result ("semihosting-output-tests");
+}
+
+// ----------------------------------------------------------------------------
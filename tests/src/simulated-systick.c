@@ -0,0 +1,289 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+#include <micro-os-plus/architecture-cortexm/tickless.h>
+#include <micro-os-plus/architecture-cortexm/tickless-inlines.h>
+
+#include <simulated-systick.h>
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+
+enum
+{
+  SYSTICK_CSR,
+  SYSTICK_RVR,
+  SYSTICK_CVR,
+  SYSTICK_ICSR,
+  SYSTICK_REGISTERS
+};
+
+static struct
+{
+  uint32_t divider;
+  uint64_t cycles;
+  uint64_t clocks;
+  uint32_t csr;
+  uint32_t rvr;
+  uint32_t cvr;
+  bool pending;
+  bool in_handler;
+  uint32_t interrupts;
+  uint32_t expirations;
+} systick;
+
+// The registers as seen by the code; a value other than the one
+// returned by the last access means a write.
+static volatile uint32_t systick_registers[SYSTICK_REGISTERS];
+static uint32_t systick_returned[SYSTICK_REGISTERS];
+
+// ----------------------------------------------------------------------------
+
+static void
+systick_count (uint64_t clocks)
+{
+  while (clocks > 0)
+    {
+      if (systick.cvr == 0)
+        {
+          systick.cvr = systick.rvr;
+          ++systick.clocks;
+          --clocks;
+        }
+      else if (clocks < systick.cvr)
+        {
+          systick.cvr -= (uint32_t)clocks;
+          systick.clocks += clocks;
+          clocks = 0;
+        }
+      else
+        {
+          // Reaching 0 pends the interrupt; the reload is at the
+          // next clock.
+          clocks -= systick.cvr;
+          systick.clocks += systick.cvr;
+          systick.cvr = 0;
+          if ((systick.csr & CORTEXM_ARCHITECTURE_SYST_CSR_TICKINT) != 0)
+            {
+              systick.pending = true;
+            }
+        }
+    }
+}
+
+static void
+systick_run (uint64_t cycles)
+{
+  if ((systick.csr & CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE) != 0)
+    {
+      systick_count ((systick.cycles + cycles) / systick.divider
+                     - systick.cycles / systick.divider);
+    }
+  systick.cycles += cycles;
+}
+
+// The writes done since the previous access.
+static void
+systick_commit (void)
+{
+  for (int i = 0; i < SYSTICK_REGISTERS; ++i)
+    {
+      uint32_t value = systick_registers[i];
+      if (value == systick_returned[i])
+        {
+          continue;
+        }
+      systick_returned[i] = value;
+
+      switch (i)
+        {
+        case SYSTICK_CSR:
+          systick.csr = value;
+          break;
+
+        case SYSTICK_RVR:
+          systick.rvr = value & CORTEXM_ARCHITECTURE_SYST_RVR_MAX;
+          break;
+
+        case SYSTICK_CVR:
+          // Any value clears it, without an interrupt.
+          systick.cvr = 0;
+          break;
+
+        case SYSTICK_ICSR:
+          if ((value & CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTCLR) != 0)
+            {
+              systick.pending = false;
+            }
+          if ((value & CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET) != 0)
+            {
+              systick.pending = true;
+            }
+          break;
+        }
+    }
+}
+
+static void
+systick_interrupt (void)
+{
+  if (!systick.pending || systick.in_handler
+      || (systick.csr & CORTEXM_ARCHITECTURE_SYST_CSR_TICKINT) == 0
+      || cortexm_architecture_interrupts_get_primask () != 0)
+    {
+      return;
+    }
+
+  // The exception entry clears the pending state.
+  systick.pending = false;
+  systick.in_handler = true;
+
+  ++systick.interrupts;
+  if (cortexm_architecture_tickless_interrupt_handler ())
+    {
+      ++systick.expirations;
+    }
+
+  systick.in_handler = false;
+}
+
+static volatile uint32_t*
+systick_register (int index)
+{
+  systick_commit ();
+  systick_run (1);
+  systick_interrupt ();
+
+  uint32_t value = 0;
+  switch (index)
+    {
+    case SYSTICK_CSR:
+      value = systick.csr;
+      break;
+
+    case SYSTICK_RVR:
+      value = systick.rvr;
+      break;
+
+    case SYSTICK_CVR:
+      value = systick.cvr;
+      break;
+
+    case SYSTICK_ICSR:
+      value = systick.pending ? CORTEXM_ARCHITECTURE_SCB_ICSR_PENDSTSET : 0;
+      break;
+    }
+
+  systick_returned[index] = value;
+  systick_registers[index] = value;
+
+  return &systick_registers[index];
+}
+
+// With PRIMASK set, `wfi` returns when an interrupt is pending; only
+// SysTick is simulated.
+static void
+systick_wfi (void)
+{
+  systick_commit ();
+
+  if (!systick.pending
+      && (systick.csr & CORTEXM_ARCHITECTURE_SYST_CSR_ENABLE) != 0
+      && (systick.csr & CORTEXM_ARCHITECTURE_SYST_CSR_TICKINT) != 0)
+    {
+      systick_run (simulated_systick_cycles_to_end ());
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+simulated_systick_reset (uint32_t divider)
+{
+  memset (&systick, 0, sizeof (systick));
+  systick.divider = divider;
+
+  for (int i = 0; i < SYSTICK_REGISTERS; ++i)
+    {
+      systick_registers[i] = 0;
+      systick_returned[i] = 0;
+    }
+}
+
+void
+simulated_systick_advance (uint64_t cycles)
+{
+  systick_commit ();
+  systick_run (cycles);
+  systick_interrupt ();
+}
+
+uint64_t
+simulated_systick_cycles_to_end (void)
+{
+  systick_commit ();
+
+  // The clocks happen when the cycles are a multiple of the divider.
+  uint64_t clocks
+      = (systick.cvr == 0) ? (uint64_t)systick.rvr + 1 : systick.cvr;
+  return clocks * systick.divider - systick.cycles % systick.divider;
+}
+
+uint64_t
+simulated_systick_clocks (void)
+{
+  systick_commit ();
+  return systick.clocks;
+}
+
+bool
+simulated_systick_pending (void)
+{
+  systick_commit ();
+  return systick.pending;
+}
+
+uint32_t
+simulated_systick_interrupts (void)
+{
+  return systick.interrupts;
+}
+
+uint32_t
+simulated_systick_expirations (void)
+{
+  return systick.expirations;
+}
+
+// ----------------------------------------------------------------------------
+// The code under test, with the registers and `wfi` redirected.
+
+#undef CORTEXM_ARCHITECTURE_SYST_CSR
+#undef CORTEXM_ARCHITECTURE_SYST_RVR
+#undef CORTEXM_ARCHITECTURE_SYST_CVR
+#undef CORTEXM_ARCHITECTURE_SCB_ICSR
+
+#define CORTEXM_ARCHITECTURE_SYST_CSR (*systick_register (SYSTICK_CSR))
+#define CORTEXM_ARCHITECTURE_SYST_RVR (*systick_register (SYSTICK_RVR))
+#define CORTEXM_ARCHITECTURE_SYST_CVR (*systick_register (SYSTICK_CVR))
+#define CORTEXM_ARCHITECTURE_SCB_ICSR (*systick_register (SYSTICK_ICSR))
+
+#define cortexm_architecture_wfi systick_wfi
+
+#include "../../src/tickless.c"
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// Not part of the synthetic architecture; `src/stack.c` is compiled
+// by `host-stack.c`.
+#include <micro-os-plus/architecture-cortexm/stack.h>
+#include <micro-os-plus/architecture-cortexm/stack-inlines.h>
+
+#include <test-checks.h>
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace stack = cortexm::architecture::stack;
+
+  constexpr uint32_t magic = MICRO_OS_PLUS_INTEGER_STARTUP_STACK_FILL_MAGIC;
+
+  // 8 blocks of 8 words, and a few more words.
+  constexpr uint32_t words = 64;
+  uint32_t buffer[words + 5];
+
+  // The stack [0, size) is painted up to `mark`, the high-water mark,
+  // and used above.
+  void
+  prepare (uint32_t size, uint32_t mark)
+  {
+    for (uint32_t i = 0; i < words + 5; ++i)
+      {
+        buffer[i] = 0x12345678;
+      }
+    stack::paint (buffer, buffer + mark);
+    for (uint32_t i = mark; i < size; ++i)
+      {
+        buffer[i] = i;
+      }
+  }
+
+  void
+  test_paint (void)
+  {
+    // Not multiples of the 8 word stores, and nothing outside.
+    for (uint32_t size : { 0u, 1u, 7u, 8u, 9u, 17u, words })
+      {
+        prepare (size, size);
+        for (uint32_t i = 0; i < size; ++i)
+          {
+            MICRO_OS_PLUS_TEST_CHECK (buffer[i] == magic);
+          }
+        MICRO_OS_PLUS_TEST_CHECK (buffer[size] == 0x12345678);
+      }
+  }
+
+  // Every position of the mark, in stacks with and without a partial
+  // last block.
+  void
+  test_mark (void)
+  {
+    for (uint32_t size : { words, words + 5 })
+      {
+        for (uint32_t mark = 0; mark <= size; ++mark)
+          {
+            prepare (size, mark);
+            uint32_t used = (size - mark) * sizeof (uint32_t);
+            MICRO_OS_PLUS_TEST_CHECK (stack::used (buffer, buffer + size)
+                                      == used);
+            MICRO_OS_PLUS_TEST_CHECK (
+                stack::used_fast (buffer, buffer + size) == used);
+          }
+      }
+
+    // Empty.
+    MICRO_OS_PLUS_TEST_CHECK (stack::used (buffer, buffer) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (stack::used_fast (buffer, buffer) == 0);
+  }
+
+  // The block of the mark is partially overwritten: the words above
+  // the deepest one written include painted ones, never written.
+  void
+  test_partial_block (void)
+  {
+    for (uint32_t mark = 8; mark < 16; ++mark)
+      {
+        prepare (words, mark);
+        for (uint32_t i = mark + 1; i < 16; i += 2)
+          {
+            buffer[i] = magic;
+          }
+        uint32_t used = (words - mark) * sizeof (uint32_t);
+        MICRO_OS_PLUS_TEST_CHECK (stack::used (buffer, buffer + words)
+                                  == used);
+        MICRO_OS_PLUS_TEST_CHECK (stack::used_fast (buffer, buffer + words)
+                                  == used);
+      }
+  }
+
+  // A whole painted block in the used part, like a local buffer never
+  // written, may stop the binary search; the exact scan is not fooled.
+  void
+  test_hole (void)
+  {
+    prepare (words, 16);
+    stack::paint (buffer + 32, buffer + 40);
+
+    MICRO_OS_PLUS_TEST_CHECK (stack::used (buffer, buffer + words)
+                              == (words - 16) * sizeof (uint32_t));
+    // The first probe is the block at 32.
+    MICRO_OS_PLUS_TEST_CHECK (stack::used_fast (buffer, buffer + words)
+                              == (words - 40) * sizeof (uint32_t));
+
+    // Not probed, no effect.
+    prepare (words, 16);
+    stack::paint (buffer + 40, buffer + 48);
+    MICRO_OS_PLUS_TEST_CHECK (stack::used_fast (buffer, buffer + words)
+                              == (words - 16) * sizeof (uint32_t));
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_paint ();
+  test_mark ();
+  test_partial_block ();
+  test_hole ();
+
+  // Also via semihosting.
+  prepare (words, 20);
+  stack::descriptor_t stacks[] = { { "test", buffer, buffer + words } };
+  stack::report (stacks, 1);
+
+  return micro_os_plus::test::result ("stack-tests");
+}
+
+// ----------------------------------------------------------------------------
@@ -0,0 +1,319 @@
+/*
+ * This file is part of the µOS++ distribution.
+ *   (https://github.com/micro-os-plus/)
+ * Copyright (c) 2023 Liviu Ionescu.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose is hereby granted, under the terms of the MIT license.
+ *
+ * If a copy of the license was not distributed with this file, it can
+ * be obtained from https://opensource.org/licenses/MIT/.
+ */
+
+// ----------------------------------------------------------------------------
+
+#include <micro-os-plus/architecture.h>
+
+// Not part of the synthetic architecture; `src/tickless.c` runs on a
+// simulated SysTick.
+#include <micro-os-plus/architecture-cortexm/system-control-space.h>
+#include <micro-os-plus/architecture-cortexm/tickless.h>
+#include <micro-os-plus/architecture-cortexm/tickless-inlines.h>
+
+#include <simulated-systick.h>
+#include <test-checks.h>
+
+// ----------------------------------------------------------------------------
+
+#if !defined(MICRO_OS_PLUS_ARCHITECTURE_TICKLESS)
+#error "Build with MICRO_OS_PLUS_ARCHITECTURE_TICKLESS"
+#endif
+
+namespace
+{
+  // --------------------------------------------------------------------------
+
+  namespace tickless = cortexm::architecture::tickless;
+
+  void
+  test_exact (void)
+  {
+    // One cycle per nanosecond.
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (0, 1000000000) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (12345, 1000000000)
+                              == 12345);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (12345, 1000000000)
+                              == 12345);
+
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (48, 48000000) == 1000);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (1000, 48000000) == 48);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (48000000, 48000000)
+                              == 1000000000);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (1000000000, 48000000)
+                              == 48000000);
+
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (8, 64000000) == 125);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (125, 64000000) == 8);
+  }
+
+  void
+  test_rounding (void)
+  {
+    // 20.83 ns per cycle at 48 MHz.
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (1, 48000000) == 20);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (47, 48000000) == 979);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (20, 48000000) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (21, 48000000) == 1);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (999, 48000000) == 47);
+
+    // 15.625 ns per cycle at 64 MHz.
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (1, 64000000) == 15);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (15, 64000000) == 0);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (16, 64000000) == 1);
+  }
+
+  // The direct products would overflow.
+  void
+  test_large (void)
+  {
+    MICRO_OS_PLUS_TEST_CHECK (tickless::cycles_to_ns (UINT64_MAX, 1000000000)
+                              == UINT64_MAX);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (UINT64_MAX, 1000000000)
+                              == UINT64_MAX);
+
+    MICRO_OS_PLUS_TEST_CHECK (
+        tickless::cycles_to_ns (48000000ULL * 10000000000ULL + 47, 48000000)
+        == 10000000000000000979ULL);
+    MICRO_OS_PLUS_TEST_CHECK (tickless::ns_to_cycles (UINT64_MAX, 48000000)
+                              == 885443715538058477ULL);
+  }
+
+  // Rounding down both ways loses at most one cycle, and never gains.
+  void
+  test_round_trip (void)
+  {
+    const uint32_t clocks[] = { 32768, 8000000, 48000000, 64000000,
+                                168000000, 480000000, 1000000000 };
+
+    uint64_t value = 1;
+    for (uint32_t clock_hz : clocks)
+      {
+        for (int i = 0; i < 1000; ++i)
+          {
+            // A 64-bit linear congruential sequence; up to 2^40 cycles.
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+            uint64_t cycles = value >> 24;
+
+            uint64_t ns = tickless::cycles_to_ns (cycles, clock_hz);
+            MICRO_OS_PLUS_TEST_CHECK (
+                tickless::ns_to_cycles (ns, clock_hz) <= cycles);
+            MICRO_OS_PLUS_TEST_CHECK (
+                tickless::ns_to_cycles (ns, clock_hz) + 1 >= cycles);
+
+            ns = value >> 8;
+            MICRO_OS_PLUS_TEST_CHECK (
+                tickless::cycles_to_ns (tickless::ns_to_cycles (ns, clock_hz),
+                                        clock_hz)
+                <= ns);
+          }
+      }
+  }
+
+  // --------------------------------------------------------------------------
+  // The clock, on a simulated SysTick.
+
+  constexpr uint64_t period = CORTEXM_ARCHITECTURE_SYST_RVR_MAX + 1;
+
+  // Read the clock and check it against the SysTick clocks before
+  // and after; the clock starts at the first reload. The restarts
+  // for the deadlines lose a few clocks each.
+  uint64_t
+  check_now (uint64_t& previous, uint64_t lost = 0)
+  {
+    uint64_t before = simulated_systick_clocks () - 1;
+    uint64_t now = tickless::now_cycles ();
+    uint64_t after = simulated_systick_clocks () - 1;
+
+    MICRO_OS_PLUS_TEST_CHECK (now >= previous);
+    MICRO_OS_PLUS_TEST_CHECK (now + lost >= before);
+    MICRO_OS_PLUS_TEST_CHECK (now <= after);
+
+    previous = now;
+    return now;
+  }
+
+  void
+  test_initialize (void)
+  {
+    simulated_systick_reset (1);
+    tickless::initialize (1000000);
+
+    uint64_t previous = 0;
+    MICRO_OS_PLUS_TEST_CHECK (check_now (previous) < 10);
+    uint64_t ns = tickless::now_ns ();
+    MICRO_OS_PLUS_TEST_CHECK (ns >= previous * 1000);
+    MICRO_OS_PLUS_TEST_CHECK (ns < (previous + 10) * 1000);
+  }
+
+  // With the interrupts masked, the end of the period is seen pending
+  // while the counter is still 0, for a few reads with a divider.
+  void
+  test_wrap (uint32_t divider)
+  {
+    simulated_systick_reset (divider);
+    tickless::initialize (1000000);
+
+    uint64_t previous = 0;
+    cortexm_architecture_interrupts_disable ();
+    simulated_systick_advance (simulated_systick_cycles_to_end ()
+                               - 20 * divider);
+
+    for (uint32_t i = 0; i < 40 * divider; ++i)
+      {
+        check_now (previous);
+        simulated_systick_advance (1);
+      }
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_pending ());
+    MICRO_OS_PLUS_TEST_CHECK (previous > period);
+
+    // The wrap is accounted before the handler, which must not
+    // account it again.
+    tickless::set_deadline (tickless::no_deadline);
+    check_now (previous);
+
+    cortexm_architecture_interrupts_enable ();
+    simulated_systick_advance (1);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_interrupts () == 1);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_expirations () == 0);
+    check_now (previous);
+  }
+
+  // The period ends while the clock is read, and the handler preempts
+  // the reader, which must retry.
+  void
+  test_preempted (uint32_t divider)
+  {
+    uint32_t preempted = 0;
+
+    for (uint32_t offset = 0; offset < 8 * divider; ++offset)
+      {
+        simulated_systick_reset (divider);
+        tickless::initialize (1000000);
+
+        uint64_t previous = 0;
+        simulated_systick_advance (simulated_systick_cycles_to_end ()
+                                   - offset);
+
+        uint32_t interrupts = simulated_systick_interrupts ();
+        check_now (previous);
+        if (simulated_systick_interrupts () != interrupts)
+          {
+            ++preempted;
+          }
+
+        simulated_systick_advance (offset + 4 * divider);
+        MICRO_OS_PLUS_TEST_CHECK (simulated_systick_interrupts () == 1);
+        check_now (previous);
+      }
+
+    MICRO_OS_PLUS_TEST_CHECK (preempted > 0);
+  }
+
+  // Deadlines nearer than the end of the period restart it.
+  void
+  test_schedule (uint64_t distance, uint32_t interrupts)
+  {
+    simulated_systick_reset (8);
+    tickless::initialize (1000000);
+
+    uint64_t previous = 0;
+    uint64_t deadline = check_now (previous) + distance;
+    tickless::set_deadline (deadline);
+
+    while (simulated_systick_expirations () == 0)
+      {
+        simulated_systick_advance (4096);
+        check_now (previous, 8);
+      }
+
+    MICRO_OS_PLUS_TEST_CHECK (previous >= deadline);
+    MICRO_OS_PLUS_TEST_CHECK (previous < deadline + 1024);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_interrupts () == interrupts);
+
+    // Without a deadline, the periods are the longest.
+    simulated_systick_advance (period * 8);
+    check_now (previous, 8);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_interrupts ()
+                              == interrupts + 1);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_expirations () == 1);
+  }
+
+  // The core wakes at the end of the period, which reads 0 until the
+  // next SysTick clock.
+  void
+  test_idle (uint32_t divider)
+  {
+    simulated_systick_reset (divider);
+    tickless::initialize (1000000);
+
+    uint64_t previous = 0;
+    uint64_t deadline = check_now (previous) + 100000;
+
+    cortexm_architecture_interrupts_disable ();
+    uint64_t now = tickless::idle (deadline);
+
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_pending ());
+    MICRO_OS_PLUS_TEST_CHECK (now + 1 >= deadline);
+    MICRO_OS_PLUS_TEST_CHECK (now <= simulated_systick_clocks () - 1);
+    MICRO_OS_PLUS_TEST_CHECK (now < deadline + 8);
+    check_now (previous, 8);
+    MICRO_OS_PLUS_TEST_CHECK (previous >= now);
+
+    cortexm_architecture_interrupts_enable ();
+    simulated_systick_advance (1);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_expirations () == 1);
+    check_now (previous, 8);
+
+    // Already expired; the shortest period.
+    cortexm_architecture_interrupts_disable ();
+    now = tickless::idle (previous);
+    constexpr uint64_t shortest
+        = MICRO_OS_PLUS_ARCHITECTURE_TICKLESS_MIN_CYCLES;
+    MICRO_OS_PLUS_TEST_CHECK (now + 1 >= previous + shortest);
+    cortexm_architecture_interrupts_enable ();
+    simulated_systick_advance (1);
+    MICRO_OS_PLUS_TEST_CHECK (simulated_systick_expirations () == 2);
+    check_now (previous, 16);
+  }
+
+  // --------------------------------------------------------------------------
+} // namespace
+
+// ----------------------------------------------------------------------------
+
+int
+main (int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  test_exact ();
+  test_rounding ();
+  test_large ();
+  test_round_trip ();
+
+  test_initialize ();
+  for (uint32_t divider : { 1, 2, 8 })
+    {
+      test_wrap (divider);
+      test_preempted (divider);
+      test_idle (divider);
+    }
+  // Within the current period, two periods later.
+  test_schedule (50000, 1);
+  test_schedule (2 * period + 12345, 3);
+
+  return micro_os_plus::test::result ("tickless-tests");
+}
+
+// ----------------------------------------------------------------------------